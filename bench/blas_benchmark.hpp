@@ -30,12 +30,21 @@
 #ifndef BLAS_BENCHMARK_HPP
 #define BLAS_BENCHMARK_HPP
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
 #include <string>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 
 template <typename ScalarT>
 ScalarT *new_data(size_t size, bool initialized = true) {
@@ -49,32 +58,390 @@ ScalarT *new_data(size_t size, bool initialized = true) {
 }
 #define release_data(ptr) delete[](ptr);
 
+/** strided_base.
+ * Pointer the routines take for a vector of size elements with the given
+ * increment: as in vector_view, a negative increment walks the vector back
+ * from its last element in memory, so that element is passed.
+ */
+template <typename ScalarT>
+ScalarT *strided_base(ScalarT *ptr, size_t size, long stride) {
+  return (stride < 0) ? ptr + (size - 1) * size_t(-stride) : ptr;
+}
+
+/** sample_statistics.
+ * Summary of the per-iteration samples of a benchmark, in nanoseconds.
+ * Percentiles, min and max are computed over every sample so that the tail is
+ * preserved; mean, stddev and the confidence interval are computed once the
+ * outliers have been rejected.
+ */
+struct sample_statistics {
+  size_t num_samples = 0;
+  size_t num_outliers = 0;
+  double mean = 0;
+  double stddev = 0;
+  double min = 0;
+  double max = 0;
+  double p50 = 0;
+  double p95 = 0;
+  double p99 = 0;
+  // half-width of the 95% confidence interval of the mean, relative to it
+  double ci_rel = 0;
+  bool noisy = false;
+};
+
+/** benchmark_result.
+ * Everything a benchmark function returns: the work done by one iteration
+ * (floating point operations and bytes moved to or from global memory) and
+ * the raw samples with their statistics.
+ */
+struct benchmark_result {
+  size_t flops = 0;
+  size_t bytes = 0;
+  // problem shape (e.g. "m=64,n=64") and increment, for the structured
+  // outputs; an empty shape is reported as "n=<size>"
+  std::string shape;
+  long stride = 1;
+  // extra named figures (e.g. the speedup over a reference implementation),
+  // every run of a benchmark binary must report the same counters
+  std::vector<std::pair<std::string, double>> counters;
+  std::vector<double> samples;
+  sample_statistics stats;
+
+  double flops_per_second() const {
+    return (stats.mean > 0) ? double(flops) / (stats.mean * 1e-9) : 0;
+  }
+
+  double bytes_per_second() const {
+    return (stats.mean > 0) ? double(bytes) / (stats.mean * 1e-9) : 0;
+  }
+
+  /*! arithmetic_intensity.
+   * Flops per byte moved, the x coordinate of the routine on a roofline plot.
+   */
+  double arithmetic_intensity() const {
+    return (bytes > 0) ? double(flops) / double(bytes) : 0;
+  }
+};
+
+/** device_roofline.
+ * Peak figures of the device the benchmarks run on, used to report how far
+ * each routine is from the roofline. A value of zero means "not measured".
+ */
+struct device_roofline {
+  double peak_bytes_per_second = 0;
+
+  static device_roofline &get() {
+    static device_roofline roofline;
+    return roofline;
+  }
+
+  double bandwidth_fraction(const benchmark_result &result) const {
+    return (peak_bytes_per_second > 0)
+               ? result.bytes_per_second() / peak_bytes_per_second
+               : 0;
+  }
+};
+
+/** benchmark_settings.
+ * Controls the adaptive repetition of benchmark<>::measure. The number of
+ * repetitions passed to measure is the minimum number of samples; sampling
+ * continues until the relative half-width of the 95% confidence interval of
+ * the mean drops below ci_target, or max_reps / max_seconds is reached.
+ */
+struct benchmark_settings {
+  size_t warmup_reps = 5;
+  size_t max_reps = 1000;
+  double max_seconds = 10.0;
+  double ci_target = 0.02;
+  // samples further than outlier_mads median absolute deviations from the
+  // median are rejected from the mean
+  double outlier_mads = 5.0;
+  // coefficient of variation above which a run is flagged as noisy
+  double noisy_cv = 0.05;
+
+  static benchmark_settings &get() {
+    static benchmark_settings settings;
+    return settings;
+  }
+};
+
+/** percentile.
+ * Nearest-rank percentile of an already sorted sample.
+ */
+inline double percentile(const std::vector<double> &sorted, double pct) {
+  if (sorted.empty()) return 0;
+  size_t rank = size_t(std::ceil(pct / 100.0 * sorted.size()));
+  return sorted[(rank == 0) ? 0 : rank - 1];
+}
+
+/** student_t_95.
+ * Two-sided 95% critical value of the Student t distribution with df degrees
+ * of freedom, falling back to the normal approximation for large samples.
+ */
+inline double student_t_95(size_t df) {
+  static const double table[] = {12.706, 4.303, 2.571, 2.447, 2.365, 2.306,
+                                 2.262, 2.228, 2.201, 2.179, 2.160, 2.145,
+                                 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                 2.080, 2.074, 2.069, 2.064, 2.060, 2.056,
+                                 2.052, 2.048, 2.045, 2.042, 2.040, 2.037};
+  if (df == 0) return table[0];
+  return (df <= 30) ? table[df - 1] : 1.96;
+}
+
+inline sample_statistics compute_statistics(
+    const std::vector<double> &samples) {
+  const auto &settings = benchmark_settings::get();
+  sample_statistics st;
+  st.num_samples = samples.size();
+  if (samples.empty()) return st;
+
+  std::vector<double> sorted(samples);
+  std::sort(sorted.begin(), sorted.end());
+  st.min = sorted.front();
+  st.max = sorted.back();
+  st.p50 = percentile(sorted, 50);
+  st.p95 = percentile(sorted, 95);
+  st.p99 = percentile(sorted, 99);
+
+  // median absolute deviation, scaled to be comparable to a stddev
+  std::vector<double> deviations;
+  deviations.reserve(sorted.size());
+  for (auto s : sorted) deviations.push_back(std::fabs(s - st.p50));
+  std::sort(deviations.begin(), deviations.end());
+  const double mad = 1.4826 * percentile(deviations, 50);
+
+  double sum = 0;
+  size_t kept = 0;
+  for (auto s : sorted) {
+    if (mad > 0 && std::fabs(s - st.p50) > settings.outlier_mads * mad) {
+      st.num_outliers++;
+      continue;
+    }
+    sum += s;
+    kept++;
+  }
+  st.mean = sum / kept;
+  double sq = 0;
+  for (auto s : sorted) {
+    if (mad > 0 && std::fabs(s - st.p50) > settings.outlier_mads * mad)
+      continue;
+    sq += (s - st.mean) * (s - st.mean);
+  }
+  st.stddev = (kept > 1) ? std::sqrt(sq / (kept - 1)) : 0;
+  st.ci_rel = (kept > 1 && st.mean > 0)
+                  ? student_t_95(kept - 1) * st.stddev /
+                        (std::sqrt(double(kept)) * st.mean)
+                  : 0;
+  st.noisy = (st.mean > 0 && st.stddev / st.mean > settings.noisy_cv) ||
+             (st.ci_rel > settings.ci_target) ||
+             (st.num_outliers * 10 > st.num_samples);
+  return st;
+}
+
+/** benchmark_output.
+ * Where and in which format benchmark<>::output_data reports: the text table
+ * for humans, or one CSV row / JSON object per run for tooling such as
+ * bench/compare_results.py. The context (library, device, ...) is recorded
+ * once per run by the benchmarker and written with the results.
+ */
+struct benchmark_output {
+  enum class format { text, csv, json };
+  using field = std::pair<std::string, std::string>;
+
+  format fmt = format::text;
+  std::ofstream file;
+  std::ostream *out = &std::cout;
+  std::vector<field> context;
+  size_t num_records = 0;
+
+  static benchmark_output &get() {
+    static benchmark_output output;
+    return output;
+  }
+
+  void set_context(const std::string &key, const std::string &value) {
+    for (auto &f : context) {
+      if (f.first == key) {
+        f.second = value;
+        return;
+      }
+    }
+    context.emplace_back(key, value);
+  }
+
+  bool open(const std::string &path) {
+    file.open(path);
+    if (!file) {
+      std::cerr << "Cannot open " << path << std::endl;
+      return false;
+    }
+    out = &file;
+    return true;
+  }
+
+  static std::string json_escape(const std::string &text) {
+    std::string escaped;
+    for (auto c : text) {
+      if (c == '"' || c == '\\') {
+        escaped += '\\';
+        escaped += c;
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        escaped += ' ';
+      } else {
+        escaped += c;
+      }
+    }
+    return escaped;
+  }
+
+  static std::string csv_escape(const std::string &text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) return text;
+    std::string escaped("\"");
+    for (auto c : text) {
+      if (c == '"') escaped += '"';
+      escaped += c;
+    }
+    return escaped + "\"";
+  }
+
+  /*! write_record.
+   * Writes one run; numeric values are written unquoted in JSON, which is
+   * why every field says whether it is a string.
+   */
+  void write_record(const std::vector<std::pair<field, bool>> &fields) {
+    if (fmt == format::csv) {
+      if (num_records == 0) {
+        std::string sep;
+        for (auto &f : context) {
+          *out << sep << csv_escape(f.first);
+          sep = ",";
+        }
+        for (auto &f : fields) {
+          *out << sep << f.first.first;
+          sep = ",";
+        }
+        *out << std::endl;
+      }
+      std::string sep;
+      for (auto &f : context) {
+        *out << sep << csv_escape(f.second);
+        sep = ",";
+      }
+      for (auto &f : fields) {
+        *out << sep << csv_escape(f.first.second);
+        sep = ",";
+      }
+      *out << std::endl;
+    } else if (fmt == format::json) {
+      if (num_records == 0) write_json_context();
+      *out << ((num_records == 0) ? "\n" : ",\n") << "    {";
+      std::string sep;
+      for (auto &f : fields) {
+        *out << sep << "\"" << f.first.first << "\": ";
+        if (f.second) {
+          *out << "\"" << json_escape(f.first.second) << "\"";
+        } else {
+          *out << f.first.second;
+        }
+        sep = ", ";
+      }
+      *out << "}";
+    }
+    num_records++;
+  }
+
+  void write_json_context() {
+    *out << "{\n  \"context\": {";
+    std::string sep;
+    for (auto &f : context) {
+      *out << sep << "\n    \"" << json_escape(f.first) << "\": \""
+           << json_escape(f.second) << "\"";
+      sep = ",";
+    }
+    *out << "\n  },\n  \"benchmarks\": [";
+  }
+
+  /*! finish.
+   * Closes the JSON document; called once all the benchmarks have run.
+   */
+  void finish() {
+    if (fmt == format::json) {
+      if (num_records == 0) write_json_context();
+      *out << "\n  ]\n}" << std::endl;
+    }
+    out->flush();
+  }
+};
+
+/** replace_samples.
+ * Replaces the samples of a measurement with the ones the timed function
+ * collected itself, for phases that cannot be timed in isolation (e.g. the
+ * first kernel after an allocation). The first samples collected come from
+ * the warm-up and are dropped.
+ */
+inline benchmark_result replace_samples(benchmark_result result,
+                                        const std::vector<double> &samples) {
+  result.samples.assign(samples.end() - result.samples.size(), samples.end());
+  result.stats = compute_statistics(result.samples);
+  return result;
+}
+
 template <typename time_units_t_ = std::chrono::nanoseconds,
-          typename ClockT = std::chrono::system_clock>
+          typename ClockT = std::chrono::steady_clock>
 struct benchmark {
   using time_units_t = time_units_t_;
+  static_assert(ClockT::is_steady, "benchmarks require a monotonic clock");
 
+  /** measure.
+   * Runs func at least numReps times, after the warm-up, and keeps sampling
+   * until the confidence interval of the mean is tight enough.
+   * @param numReps Minimum number of timed repetitions.
+   * @param flops Floating point operations performed by one call to func.
+   * @param bytes Bytes read from and written to global memory by one call.
+   */
   template <typename F, typename... Args>
-  static double measure(size_t numReps, size_t flops, F func, Args &&... args) {
-    time_units_t dur = time_units_t::zero();
+  static benchmark_result measure(size_t numReps, size_t flops, size_t bytes,
+                                  F func, Args &&... args) {
+    const auto &settings = benchmark_settings::get();
+    benchmark_result result;
+    result.flops = flops;
+    result.bytes = bytes;
 
     // warm up to avoid benchmarking data transfer
-    for (int i = 0; i < 5; ++i) {
+    for (size_t i = 0; i < settings.warmup_reps; ++i) {
       func(std::forward<Args>(args)...);
     }
 
-    for (size_t reps = 0; reps < numReps; reps++) {
+    const size_t min_reps = std::max<size_t>(numReps, 2);
+    const size_t max_reps = std::max(min_reps, settings.max_reps);
+    const auto budget = std::chrono::duration<double>(settings.max_seconds);
+    const auto begin = ClockT::now();
+    result.samples.reserve(min_reps);
+    for (size_t reps = 0; reps < max_reps; reps++) {
       auto start = ClockT::now();
       func(std::forward<Args>(args)...);
       auto end = ClockT::now();
-      dur += end - start;
+      result.samples.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+
+      if (reps + 1 < min_reps) continue;
+      if (end - begin > budget) break;
+      // re-evaluating the statistics on every sample is quadratic, only do it
+      // when the sample count grows by a tenth
+      if ((reps + 1) == min_reps || (reps + 1) % (min_reps / 10 + 1) == 0) {
+        auto st = compute_statistics(result.samples);
+        if (st.ci_rel <= settings.ci_target) break;
+      }
     }
-    return (double(flops) * numReps) / (dur.count() * 1e-9);
+    result.stats = compute_statistics(result.samples);
+    return result;
   }
 
   static constexpr const size_t text_name_length = 30;
-  static constexpr const size_t text_iterations_length = 15;
-  static constexpr const size_t text_flops_length = 10;
+  static constexpr const size_t text_iterations_length = 12;
+  static constexpr const size_t text_flops_length = 12;
+  static constexpr const size_t text_time_length = 12;
+  static constexpr const size_t text_bandwidth_length = 10;
 
   static std::string align_left(std::string &&text, size_t len,
                                 size_t offset = 0) {
@@ -84,44 +451,365 @@ struct benchmark {
                               ' ');
   }
 
-  static void output_headers() {
-    std::cout << align_left("Test", text_name_length)
-              << align_left("Iterations", text_iterations_length)
-              << align_left("Performance", text_flops_length) << std::endl;
+  static std::string format_us(double ns) {
+    std::ostringstream str;
+    str << std::fixed << std::setprecision(2) << ns * 1e-3;
+    return str.str();
+  }
+
+  static std::string format_fixed(double value, int precision) {
+    std::ostringstream str;
+    str << std::fixed << std::setprecision(precision) << value;
+    return str.str();
+  }
+
+  static void output_headers(std::ostream &out) {
+    for (auto &f : benchmark_output::get().context) {
+      out << f.first << ": " << f.second << std::endl;
+    }
+    out << align_left("Test", text_name_length)
+        << align_left("Iterations", text_iterations_length)
+        << align_left("MFlops", text_flops_length)
+        << align_left("GB/s", text_bandwidth_length)
+        << align_left("Flop/B", text_bandwidth_length)
+        << align_left("%peak", text_bandwidth_length)
+        << align_left("p50(us)", text_time_length)
+        << align_left("p95(us)", text_time_length)
+        << align_left("p99(us)", text_time_length)
+        << align_left("min(us)", text_time_length)
+        << align_left("stddev(us)", text_time_length) << "Notes" << std::endl;
   }
 
+  static std::string format_number(double value) {
+    std::ostringstream str;
+    str << std::setprecision(10) << value;
+    return str.str();
+  }
+
+  /*! output_record.
+   * Writes one run in the structured formats. Benchmarks are named
+   * <routine>_<type>, the routine and the type are reported separately.
+   */
+  static void output_record(const std::string &short_name, int size,
+                            const benchmark_result &result) {
+    using field = benchmark_output::field;
+    const auto &st = result.stats;
+    std::string routine = short_name;
+    std::string type;
+    const auto sep = short_name.rfind('_');
+    if (sep != std::string::npos) {
+      routine = short_name.substr(0, sep);
+      type = short_name.substr(sep + 1);
+    }
+    const std::string shape =
+        result.shape.empty() ? "n=" + std::to_string(size) : result.shape;
+    const double fraction = device_roofline::get().bandwidth_fraction(result);
+    std::vector<std::pair<field, bool>> fields{
+        {field("routine", routine), true},
+        {field("type", type), true},
+        {field("shape", shape), true},
+        {field("stride", std::to_string(result.stride)), false},
+        {field("size", std::to_string(size)), false},
+        {field("iterations", std::to_string(st.num_samples)), false},
+        {field("outliers", std::to_string(st.num_outliers)), false},
+        {field("flops", std::to_string(result.flops)), false},
+        {field("bytes", std::to_string(result.bytes)), false},
+        {field("mean_ns", format_number(st.mean)), false},
+        {field("stddev_ns", format_number(st.stddev)), false},
+        {field("min_ns", format_number(st.min)), false},
+        {field("max_ns", format_number(st.max)), false},
+        {field("p50_ns", format_number(st.p50)), false},
+        {field("p95_ns", format_number(st.p95)), false},
+        {field("p99_ns", format_number(st.p99)), false},
+        {field("ci_rel", format_number(st.ci_rel)), false},
+        {field("noisy", st.noisy ? "true" : "false"), false},
+        {field("mflops", format_number(result.flops_per_second() * 1e-6)),
+         false},
+        {field("gbps", format_number(result.bytes_per_second() * 1e-9)),
+         false},
+        {field("flop_per_byte", format_number(result.arithmetic_intensity())),
+         false},
+        {field("peak_fraction", format_number(fraction)), false},
+    };
+    for (auto &c : result.counters) {
+      fields.push_back({field(c.first, format_number(c.second)), false});
+    }
+    benchmark_output::get().write_record(fields);
+  }
+
+  /*! output_data.
+   * Reports one benchmark run in the selected format. In text mode the
+   * headers are printed before the first line so that anything recorded
+   * during calibration comes before the table.
+   */
   static void output_data(const std::string &short_name, int size, int no_reps,
-                          double flops) {
-    std::cout << align_left(short_name + "_" + std::to_string(size),
-                            text_name_length)
-              << align_left(std::to_string(no_reps), text_iterations_length)
-              << align_left(std::to_string(flops * 1e-6), text_flops_length, 1)
-              << "MFlops" << std::endl;
+                          const benchmark_result &result) {
+    auto &output = benchmark_output::get();
+    if (output.fmt != benchmark_output::format::text) {
+      output_record(short_name, size, result);
+      return;
+    }
+    std::ostream &out = *output.out;
+    if (output.num_records++ == 0) output_headers(out);
+    const auto &st = result.stats;
+    const double fraction = device_roofline::get().bandwidth_fraction(result);
+    std::string notes;
+    for (auto &c : result.counters) {
+      notes += c.first + "=" + format_fixed(c.second, 2) + " ";
+    }
+    if (st.num_outliers > 0) {
+      notes += std::to_string(st.num_outliers) + " outliers ";
+    }
+    if (st.noisy) {
+      std::ostringstream str;
+      str << std::setprecision(2) << "NOISY (cv " << st.stddev / st.mean * 100
+          << "%, ci +-" << st.ci_rel * 100 << "%)";
+      notes += str.str();
+    }
+    out << align_left(short_name + "_" + std::to_string(size), text_name_length)
+        << align_left(std::to_string(st.num_samples), text_iterations_length)
+        << align_left(std::to_string(result.flops_per_second() * 1e-6),
+                      text_flops_length, 1)
+        << align_left(format_fixed(result.bytes_per_second() * 1e-9, 2),
+                      text_bandwidth_length, 1)
+        << align_left(format_fixed(result.arithmetic_intensity(), 3),
+                      text_bandwidth_length, 1)
+        << align_left((fraction > 0) ? format_fixed(fraction * 100, 1) : "-",
+                      text_bandwidth_length, 1)
+        << align_left(format_us(st.p50), text_time_length, 1)
+        << align_left(format_us(st.p95), text_time_length, 1)
+        << align_left(format_us(st.p99), text_time_length, 1)
+        << align_left(format_us(st.min), text_time_length, 1)
+        << align_left(format_us(st.stddev), text_time_length, 1) << notes
+        << std::endl;
+  }
+};
+
+/** benchmark_sizes.
+ * Multiplicative sweep from min to max, both included.
+ */
+inline std::vector<size_t> benchmark_sizes(size_t min, size_t max,
+                                           size_t step = 2) {
+  std::vector<size_t> sizes;
+  for (size_t size = min; size <= max; size *= step) sizes.push_back(size);
+  return sizes;
+}
+
+/** benchmark_args.
+ * Command line of the benchmark binaries:
+ *   --filter=REGEX      only run the benchmarks whose name matches
+ *   --sizes=N[,N...]    explicit problem sizes (1e7 is accepted)
+ *   --range=MIN:MAX[:STEP]  multiplicative sweep of problem sizes
+ *   --strides=S[,S...]  increments of the vectors, negative ones included;
+ *                       benchmarks that do not take a stride only run for 1
+ *   --reps=N            minimum number of timed repetitions
+ *   --device=NAME       default, cpu, gpu or host
+ *   --output-format=text|csv|json, --output-file=PATH
+ *   --list              print the names of the benchmarks and exit, without
+ *                       touching the device
+ * Options take their value either as --opt=value or as --opt value. The
+ * sizes replace the default sizes of every benchmark.
+ */
+struct benchmark_args {
+  std::string filter = ".*";
+  std::vector<size_t> sizes;
+  std::vector<long> strides{1};
+  size_t reps = 10;
+  std::string device = "default";
+  // Matrix Market file of the sparse benchmarks
+  std::string matrix;
+  bool list = false;
+
+  static void usage(const char *program) {
+    std::cerr << "Usage: " << program
+              << " [--filter=REGEX] [--sizes=N,...] [--range=MIN:MAX[:STEP]]"
+              << " [--strides=S,...] [--reps=N] [--device=NAME]"
+              << " [--matrix=PATH]"
+              << " [--output-format=text|csv|json] [--output-file=PATH]"
+              << " [--list]" << std::endl;
+  }
+
+  static std::vector<std::string> split(const std::string &text, char sep) {
+    std::vector<std::string> parts;
+    std::istringstream str(text);
+    std::string part;
+    while (std::getline(str, part, sep)) parts.push_back(part);
+    return parts;
+  }
+
+  // sizes go through double so that 1e7 can be written on the command line
+  static size_t parse_size(const std::string &text) {
+    return static_cast<size_t>(std::stod(text));
+  }
+
+  /*! parse.
+   * Returns false, after printing the usage, on an invalid command line.
+   */
+  bool parse(int argc, char *argv[]) {
+    auto &output = benchmark_output::get();
+    try {
+      for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        std::string value;
+        const auto eq = arg.find('=');
+        if (eq != std::string::npos) {
+          value = arg.substr(eq + 1);
+          arg = arg.substr(0, eq);
+        } else if (arg != "--list" && i + 1 < argc) {
+          value = argv[++i];
+        }
+        if (arg == "--list") {
+          list = true;
+        } else if (arg == "--filter" && !value.empty()) {
+          std::regex check(value);
+          filter = value;
+        } else if (arg == "--sizes" && !value.empty()) {
+          for (auto &s : split(value, ',')) sizes.push_back(parse_size(s));
+        } else if (arg == "--range" && !value.empty()) {
+          auto bounds = split(value, ':');
+          if (bounds.size() < 2 || bounds.size() > 3) throw std::exception();
+          const size_t step = (bounds.size() == 3) ? parse_size(bounds[2]) : 2;
+          if (step < 2) throw std::exception();
+          auto range = benchmark_sizes(parse_size(bounds[0]),
+                                       parse_size(bounds[1]), step);
+          sizes.insert(sizes.end(), range.begin(), range.end());
+        } else if (arg == "--strides" && !value.empty()) {
+          strides.clear();
+          for (auto &s : split(value, ',')) {
+            strides.push_back(std::stol(s));
+            if (strides.back() == 0) throw std::exception();
+          }
+        } else if (arg == "--reps" && !value.empty()) {
+          reps = std::stoul(value);
+        } else if (arg == "--device" &&
+                   (value == "default" || value == "cpu" || value == "gpu" ||
+                    value == "host")) {
+          device = value;
+        } else if (arg == "--matrix" && !value.empty()) {
+          matrix = value;
+        } else if (arg == "--output-format" && value == "text") {
+          output.fmt = benchmark_output::format::text;
+        } else if (arg == "--output-format" && value == "csv") {
+          output.fmt = benchmark_output::format::csv;
+        } else if (arg == "--output-format" && value == "json") {
+          output.fmt = benchmark_output::format::json;
+        } else if (arg == "--output-file" && !value.empty()) {
+          if (!output.open(value)) return false;
+        } else {
+          throw std::exception();
+        }
+      }
+    } catch (std::exception &) {
+      usage(argv[0]);
+      return false;
+    }
+    return true;
   }
 };
 
 #define BENCHMARK_FUNCTION(NAME) \
   template <class TypeParam>     \
-  double NAME(size_t no_reps, size_t size)
+  benchmark_result NAME(size_t no_reps, size_t size, long stride)
+
+/** lazy_benchmarker.
+ * Holds the benchmarker of a binary, built on its first use. Building one
+ * creates a queue and may run a calibration on the device, which listing
+ * the benchmarks (--list) must not do.
+ */
+template <typename Benchmarker>
+class lazy_benchmarker {
+  std::function<Benchmarker *()> make_;
+  std::unique_ptr<Benchmarker> object_;
+
+ public:
+  explicit lazy_benchmarker(std::function<Benchmarker *()> make)
+      : make_(make) {}
+
+  Benchmarker &get() {
+    if (!object_) object_.reset(make_());
+    return *object_;
+  }
+};
+
+template <typename Benchmarker>
+Benchmarker &benchmarker_object(Benchmarker &object) {
+  return object;
+}
+
+template <typename Benchmarker>
+Benchmarker &benchmarker_object(lazy_benchmarker<Benchmarker> &object) {
+  return object.get();
+}
 
-/** BENCHMARK_MAIN.
- * The main entry point of a benchmark
+/** benchmark_registry.
+ * The benchmarks of a binary, with the sizes each runs by default and
+ * whether it takes a stride, run according to the command line.
  */
-#define BENCHMARK_MAIN_BEGIN(STEP_SIZE_PARAM, NUM_STEPS, REPS) \
-  int main(int argc, char *argv[]) {                           \
-    benchmark<>::output_headers();                             \
-    const unsigned num_reps = (REPS);                          \
-    const unsigned step_size = (STEP_SIZE_PARAM);              \
-    const unsigned max_elems = step_size * (NUM_STEPS);        \
-    {
-#define BENCHMARK_REGISTER_FUNCTION(NAME, FUNCTION)                          \
-  for (size_t nelems = step_size; nelems < max_elems; nelems *= step_size) { \
-    const std::string short_name = NAME;                                     \
-    auto flops = blasbenchmark.FUNCTION(num_reps, nelems);                   \
-    benchmark<>::output_data(short_name, nelems, num_reps, flops);           \
-  }
-#define BENCHMARK_MAIN_END() \
-  }                          \
+class benchmark_registry {
+ public:
+  using function_t = std::function<benchmark_result(size_t, size_t, long)>;
+
+ private:
+  struct entry {
+    std::string name;
+    std::vector<size_t> sizes;
+    bool strided;
+    function_t function;
+  };
+  std::vector<entry> entries;
+
+ public:
+  void add(const std::string &name, const std::vector<size_t> &sizes,
+           function_t function, bool strided = false) {
+    entries.push_back({name, sizes, strided, function});
   }
 
+  /*! run.
+   * Runs every benchmark matching the filter, in registration order, for
+   * each size and stride, then closes the output. Returns the exit code.
+   */
+  int run(const benchmark_args &args) {
+    const std::regex filter(args.filter);
+    for (auto &e : entries) {
+      if (!std::regex_search(e.name, filter)) continue;
+      if (args.list) {
+        std::cout << e.name << std::endl;
+        continue;
+      }
+      const auto &sizes = args.sizes.empty() ? e.sizes : args.sizes;
+      for (auto stride : args.strides) {
+        if (stride != 1 && !e.strided) continue;
+        for (auto size : sizes) {
+          auto result = e.function(args.reps, size, stride);
+          result.stride = stride;
+          benchmark<>::output_data(e.name, size, args.reps, result);
+        }
+      }
+    }
+    if (!args.list) benchmark_output::get().finish();
+    return 0;
+  }
+};
+
+/** BENCHMARK_REGISTER.
+ * Registers OBJECT.FUNCTION(no_reps, size, stride) under NAME. OBJECT is a
+ * benchmarker or a lazy_benchmarker. The function is the last, variadic,
+ * argument so that template arguments can be spelled out.
+ */
+#define BENCHMARK_REGISTER(REGISTRY, OBJECT, NAME, SIZES, ...)             \
+  (REGISTRY).add(NAME, SIZES, [&](size_t reps, size_t size, long stride) { \
+    return benchmarker_object(OBJECT).__VA_ARGS__(reps, size, stride);     \
+  })
+
+/** BENCHMARK_REGISTER_STRIDED.
+ * Same as BENCHMARK_REGISTER, for functions that honour the stride.
+ */
+#define BENCHMARK_REGISTER_STRIDED(REGISTRY, OBJECT, NAME, SIZES, ...) \
+  (REGISTRY).add(NAME, SIZES,                                          \
+                 [&](size_t reps, size_t size, long stride) {          \
+                   return benchmarker_object(OBJECT).__VA_ARGS__(      \
+                       reps, size, stride);                            \
+                 },                                                    \
+                 true)
+
 #endif /* end of include guard: BLAS_BENCHMARK_HPP */
@@ -73,34 +73,43 @@ class ClBlasBenchmarker {
   Context context;
 
  public:
-  ClBlasBenchmarker() : context() { clblasSetup(); }
+  ClBlasBenchmarker() : context() {
+    clblasSetup();
+    auto &output = benchmark_output::get();
+    output.set_context("library", "clblas");
+    output.set_context("device", context.device_info(CL_DEVICE_NAME));
+    output.set_context("vendor", context.device_info(CL_DEVICE_VENDOR));
+    output.set_context("driver", context.device_info(CL_DRIVER_VERSION));
+  }
 
   BENCHMARK_FUNCTION(scal_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 1, [&]() {
+      const size_t bytes = size * 2 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 1, bytes, [&]() {
         clblasXscal<ScalarT>::func(size, alpha, buf1.dev(), 0, 1, 1,
                                    context._queue(), 0, NULL, &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(axpy_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
       MemBuffer<ScalarT> buf2(context, size);
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 1, [&]() {
+      const size_t bytes = size * 3 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 1, bytes, [&]() {
         clblasXaxpy<ScalarT>::func(size, alpha, buf1.dev(), 0, 1, buf2.dev(), 0,
                                    1, 1, context._queue(), 0, NULL,
                                    &event._cl());
@@ -108,19 +117,20 @@ class ClBlasBenchmarker {
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(asum_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT vr;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<ScalarT, CL_MEM_READ_ONLY> bufr(context, &vr, 1);
       MemBuffer<ScalarT, CL_MEM_HOST_NO_ACCESS> scratch(context, size);
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblasXasum<ScalarT>::func(size, bufr.dev(), 0, buf1.dev(), 0, 1,
                                    scratch.dev(), 1, context._queue(), 0, NULL,
                                    &event._cl());
@@ -128,19 +138,20 @@ class ClBlasBenchmarker {
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(nrm2_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT vr;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<ScalarT, CL_MEM_READ_ONLY> bufr(context, &vr, 1);
       MemBuffer<ScalarT, CL_MEM_HOST_NO_ACCESS> scratch(context, 2 * size);
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblasXnrm2<ScalarT>::func(size, bufr.dev(), 0, buf1.dev(), 0, 1,
                                    scratch.dev(), 1, context._queue(), 0, NULL,
                                    &event._cl());
@@ -148,12 +159,12 @@ class ClBlasBenchmarker {
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(dot_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT vr;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
@@ -161,7 +172,8 @@ class ClBlasBenchmarker {
       MemBuffer<ScalarT, CL_MEM_READ_ONLY> bufr(context, &vr, 1);
       MemBuffer<ScalarT, CL_MEM_HOST_NO_ACCESS> scratch(context, size);
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * 2 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblasXdot<ScalarT>::func(size, bufr.dev(), 0, buf1.dev(), 0, 1,
                                   buf2.dev(), 0, 1, scratch.dev(), 1,
                                   context._queue(), 0, NULL, &event._cl());
@@ -169,19 +181,20 @@ class ClBlasBenchmarker {
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(iamax_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       unsigned vi;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<unsigned, CL_MEM_READ_ONLY> buf_i(context, &vi, 1);
       MemBuffer<ScalarT, CL_MEM_HOST_NO_ACCESS> scratch(context, 2 * size);
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblasiXamax<ScalarT>::func(size, buf_i.dev(), 0, buf1.dev(), 0, 1,
                                     scratch.dev(), 1, context._queue(), 0, NULL,
                                     &event._cl());
@@ -189,18 +202,19 @@ class ClBlasBenchmarker {
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(scal2op_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
       MemBuffer<ScalarT> buf2(context, size);
       Event event1, event2;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * 4 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblasXscal<ScalarT>::func(size, alpha, buf1.dev(), 0, 1, 1,
                                    context._queue(), 0, NULL, &event1._cl());
         clblasXscal<ScalarT>::func(size, alpha, buf2.dev(), 0, 1, 1,
@@ -209,19 +223,20 @@ class ClBlasBenchmarker {
         Event::release({event1, event2});
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(scal3op_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
       MemBuffer<ScalarT> buf2(context, size);
       MemBuffer<ScalarT> buf3(context, size);
       Event event1, event2, event3;
-      flops = benchmark<>::measure(no_reps, size * 3, [&]() {
+      const size_t bytes = size * 6 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 3, bytes, [&]() {
         clblasXscal<ScalarT>::func(size, alpha, buf1.dev(), 0, 1, 1,
                                    context._queue(), 0, NULL, &event1._cl());
         clblasXscal<ScalarT>::func(size, alpha, buf2.dev(), 0, 1, 1,
@@ -232,12 +247,12 @@ class ClBlasBenchmarker {
         Event::release({event1, event2, event3});
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(axpy3op_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> bufsrc1(context, size);
@@ -247,7 +262,8 @@ class ClBlasBenchmarker {
       MemBuffer<ScalarT> bufdst2(context, size);
       MemBuffer<ScalarT> bufdst3(context, size);
       Event event1, event2, event3;
-      flops = benchmark<>::measure(no_reps, size * 3, [&]() {
+      const size_t bytes = size * 9 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 3, bytes, [&]() {
         clblasXaxpy<ScalarT>::func(size, alpha, bufsrc1.dev(), 0, 1,
                                    bufdst1.dev(), 0, 1, 1, context._queue(), 0,
                                    NULL, &event1._cl());
@@ -261,12 +277,12 @@ class ClBlasBenchmarker {
         Event::release({event1, event2, event3});
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(blas1_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(3.135345123);
       ScalarT vr[4];
@@ -284,7 +300,8 @@ class ClBlasBenchmarker {
       };
 
       Event events[5];
-      flops = benchmark<>::measure(no_reps, size * 12, [&]() {
+      const size_t bytes = size * 10 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 12, bytes, [&]() {
         clblasXaxpy<ScalarT>::func(size, alpha, buf1.dev(), 0, 1, buf2.dev(), 0,
                                    1, 1, context._queue(), 0, NULL,
                                    &events[0]._cl());
@@ -304,43 +321,68 @@ class ClBlasBenchmarker {
         Event::release({events[0], events[1], events[2], events[3], events[4]});
       });
     }
-    return flops;
+    return result;
   }
 
   ~ClBlasBenchmarker() { clblasTeardown(); }
 };
 
-BENCHMARK_MAIN_BEGIN(1 << 1, 1 << 24, 10);
-ClBlasBenchmarker blasbenchmark;
-
-BENCHMARK_REGISTER_FUNCTION("scal_float", scal_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal_double", scal_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("axpy_float", axpy_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("axpy_double", axpy_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("asum_float", asum_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("asum_double", asum_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("nrm2_float", nrm2_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("nrm2_double", nrm2_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("dot_float", dot_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("dot_double", dot_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("iamax_float", iamax_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("iamax_double", iamax_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("scal2op_float", scal2op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal2op_double", scal2op_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("scal3op_float", scal3op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal3op_double", scal3op_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("axpy3op_float", axpy3op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("axpy3op_double", axpy3op_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("blas1_float", blas1_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("blas1_double", blas1_bench<double>);
-
-BENCHMARK_MAIN_END();
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<ClBlasBenchmarker> blasbenchmark(
+      [&]() { return new ClBlasBenchmarker(); });
+  benchmark_registry registry;
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal_float",
+                     benchmark_sizes(2, 1 << 24), scal_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal_double",
+                     benchmark_sizes(2, 1 << 24), scal_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_float",
+                     benchmark_sizes(2, 1 << 24), axpy_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_double",
+                     benchmark_sizes(2, 1 << 24), axpy_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "asum_float",
+                     benchmark_sizes(2, 1 << 24), asum_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "asum_double",
+                     benchmark_sizes(2, 1 << 24), asum_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_float",
+                     benchmark_sizes(2, 1 << 24), nrm2_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_double",
+                     benchmark_sizes(2, 1 << 24), nrm2_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "dot_float",
+                     benchmark_sizes(2, 1 << 24), dot_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "dot_double",
+                     benchmark_sizes(2, 1 << 24), dot_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "iamax_float",
+                     benchmark_sizes(2, 1 << 24), iamax_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "iamax_double",
+                     benchmark_sizes(2, 1 << 24), iamax_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal2op_float",
+                     benchmark_sizes(2, 1 << 24), scal2op_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal2op_double",
+                     benchmark_sizes(2, 1 << 24), scal2op_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal3op_float",
+                     benchmark_sizes(2, 1 << 24), scal3op_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal3op_double",
+                     benchmark_sizes(2, 1 << 24), scal3op_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy3op_float",
+                     benchmark_sizes(2, 1 << 24), axpy3op_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy3op_double",
+                     benchmark_sizes(2, 1 << 24), axpy3op_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "blas1_float",
+                     benchmark_sizes(2, 1 << 24), blas1_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "blas1_double",
+                     benchmark_sizes(2, 1 << 24), blas1_bench<double>);
+
+  return registry.run(args);
+}
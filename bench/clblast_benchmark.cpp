@@ -36,86 +36,96 @@ class ClBlastBenchmarker {
   Context context;
 
  public:
-  ClBlastBenchmarker() : context() {}
+  ClBlastBenchmarker() : context() {
+    auto &output = benchmark_output::get();
+    output.set_context("library", "clblast");
+    output.set_context("device", context.device_info(CL_DEVICE_NAME));
+    output.set_context("vendor", context.device_info(CL_DEVICE_VENDOR));
+    output.set_context("driver", context.device_info(CL_DRIVER_VERSION));
+  }
 
   BENCHMARK_FUNCTION(scal_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 1, [&]() {
+      const size_t bytes = size * 2 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 1, bytes, [&]() {
         clblast::Scal<ScalarT>(size, alpha, buf1.dev(), 0, 1, context._queue(),
                                &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(axpy_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<ScalarT> buf2(context, size);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * 3 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Axpy<ScalarT>(size, alpha, buf1.dev(), 0, 1, buf2.dev(), 0, 1,
                                context._queue(), &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(asum_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT vr;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<ScalarT, CL_MEM_READ_ONLY> bufr(context, &vr, 1);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Asum<ScalarT>(size, bufr.dev(), 0, buf1.dev(), 0, 1,
                                context._queue(), &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(nrm2_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT vr;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<ScalarT, CL_MEM_READ_ONLY> bufr(context, &vr, 1);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Nrm2<ScalarT>(size, bufr.dev(), 0, buf1.dev(), 0, 1,
                                context._queue(), &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(dot_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT vr;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
@@ -123,65 +133,69 @@ class ClBlastBenchmarker {
       MemBuffer<ScalarT, CL_MEM_READ_ONLY> bufr(context, &vr, 1);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * 2 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Dot<ScalarT>(size, bufr.dev(), 0, buf1.dev(), 0, 1, buf2.dev(),
                               0, 1, context._queue(), &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(iamax_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       int vi;
       MemBuffer<ScalarT, CL_MEM_WRITE_ONLY> buf1(context, size);
       MemBuffer<int, CL_MEM_READ_ONLY> buf_i(context, &vi, 1);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Amax<ScalarT>(size, buf_i.dev(), 0, buf1.dev(), 0, 1,
                                context._queue(), &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   // not supported at current release yet
   BENCHMARK_FUNCTION(iamin_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       int vi;
       MemBuffer<ScalarT> buf1(context, size);
       MemBuffer<int> buf_i(context, &vi, 1);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Amin<ScalarT>(size, buf_i.dev(), 0, buf1.dev(), 0, 1,
                                context._queue(), &event._cl());
         event.wait();
         event.release();
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(scal2op_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
       MemBuffer<ScalarT> buf2(context, size);
 
       Event event1, event2;
-      flops = benchmark<>::measure(no_reps, size * 2, [&]() {
+      const size_t bytes = size * 4 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
         clblast::Scal<ScalarT>(size, alpha, buf1.dev(), 0, 1, context._queue(),
                                &event1._cl());
         clblast::Scal<ScalarT>(size, alpha, buf2.dev(), 0, 1, context._queue(),
@@ -190,12 +204,12 @@ class ClBlastBenchmarker {
         Event::release({event1, event2});
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(scal3op_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(2.4367453465);
       MemBuffer<ScalarT> buf1(context, size);
@@ -203,7 +217,8 @@ class ClBlastBenchmarker {
       MemBuffer<ScalarT> buf3(context, size);
 
       Event event1, event2, event3;
-      flops = benchmark<>::measure(no_reps, size * 3, [&]() {
+      const size_t bytes = size * 6 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 3, bytes, [&]() {
         clblast::Scal<ScalarT>(size, alpha, buf1.dev(), 0, 1, context._queue(),
                                &event1._cl());
         clblast::Scal<ScalarT>(size, alpha, buf2.dev(), 0, 1, context._queue(),
@@ -214,12 +229,12 @@ class ClBlastBenchmarker {
         Event::release({event1, event2, event3});
       });
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(axpy3op_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alphas[] = {1.78426458744, 2.187346575843, 3.78164387328};
       size_t offsets[] = {0, size, size * 2};
@@ -227,7 +242,8 @@ class ClBlastBenchmarker {
       MemBuffer<ScalarT> bufdst(context, size * 3);
 
       Event event;
-      flops = benchmark<>::measure(no_reps, size * 3 * 2, [&]() {
+      const size_t bytes = size * 9 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 3 * 2, bytes, [&]() {
         clblast::AxpyBatched<ScalarT>(size, alphas, bufsrc.dev(), offsets, 1,
                                       bufdst.dev(), offsets, 1, 3,
                                       context._queue(), &event._cl());
@@ -235,12 +251,12 @@ class ClBlastBenchmarker {
       event.wait();
       event.release();
     }
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(blas1_bench) {
     using ScalarT = TypeParam;
-    double flops;
+    benchmark_result result;
     {
       ScalarT alpha(3.135345123);
       MemBuffer<ScalarT> buf1(context, size);
@@ -251,7 +267,8 @@ class ClBlastBenchmarker {
       MemBuffer<size_t, CL_MEM_READ_ONLY> buf_i(context, &vi, 1);
 
       Event events[5];
-      flops = benchmark<>::measure(no_reps, size * 12, [&]() {
+      const size_t bytes = size * 10 * sizeof(ScalarT);
+      result = benchmark<>::measure(no_reps, size * 12, bytes, [&]() {
         clblast::Axpy<ScalarT>(size, alpha, buf1.dev(), 0, 1, buf2.dev(), 0, 1,
                                context._queue(), &events[0]._cl());
         clblast::Asum<ScalarT>(size, bufr.dev(), 0, buf2.dev(), 0, 1,
@@ -266,41 +283,66 @@ class ClBlastBenchmarker {
         Event::release({events[0], events[1], events[2], events[3], events[4]});
       });
     }
-    return flops;
+    return result;
   }
 };
 
-BENCHMARK_MAIN_BEGIN(1 << 1, 1 << 24, 10);
-ClBlastBenchmarker blasbenchmark;
-
-BENCHMARK_REGISTER_FUNCTION("scal_float", scal_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal_double", scal_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("axpy_float", axpy_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("axpy_double", axpy_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("asum_float", asum_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("asum_double", asum_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("nrm2_float", nrm2_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("nrm2_double", nrm2_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("dot_float", dot_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("dot_double", dot_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("iamax_float", iamax_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("iamax_double", iamax_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("scal2op_float", scal2op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal2op_double", scal2op_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("scal3op_float", scal3op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal3op_double", scal3op_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("axpy3op_float", axpy3op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("axpy3op_double", axpy3op_bench<double>);
-
-BENCHMARK_REGISTER_FUNCTION("blas1_float", blas1_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("blas1_double", blas1_bench<double>);
-
-BENCHMARK_MAIN_END();
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<ClBlastBenchmarker> blasbenchmark(
+      [&]() { return new ClBlastBenchmarker(); });
+  benchmark_registry registry;
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal_float",
+                     benchmark_sizes(2, 1 << 24), scal_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal_double",
+                     benchmark_sizes(2, 1 << 24), scal_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_float",
+                     benchmark_sizes(2, 1 << 24), axpy_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_double",
+                     benchmark_sizes(2, 1 << 24), axpy_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "asum_float",
+                     benchmark_sizes(2, 1 << 24), asum_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "asum_double",
+                     benchmark_sizes(2, 1 << 24), asum_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_float",
+                     benchmark_sizes(2, 1 << 24), nrm2_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_double",
+                     benchmark_sizes(2, 1 << 24), nrm2_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "dot_float",
+                     benchmark_sizes(2, 1 << 24), dot_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "dot_double",
+                     benchmark_sizes(2, 1 << 24), dot_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "iamax_float",
+                     benchmark_sizes(2, 1 << 24), iamax_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "iamax_double",
+                     benchmark_sizes(2, 1 << 24), iamax_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal2op_float",
+                     benchmark_sizes(2, 1 << 24), scal2op_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal2op_double",
+                     benchmark_sizes(2, 1 << 24), scal2op_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal3op_float",
+                     benchmark_sizes(2, 1 << 24), scal3op_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal3op_double",
+                     benchmark_sizes(2, 1 << 24), scal3op_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy3op_float",
+                     benchmark_sizes(2, 1 << 24), axpy3op_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy3op_double",
+                     benchmark_sizes(2, 1 << 24), axpy3op_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "blas1_float",
+                     benchmark_sizes(2, 1 << 24), blas1_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "blas1_double",
+                     benchmark_sizes(2, 1 << 24), blas1_bench<double>);
+
+  return registry.run(args);
+}
@@ -27,6 +27,7 @@
 #define CLWRAP_HPP
 
 #include <stdexcept>
+#include <string>
 
 #include <CL/cl.h>
 
@@ -118,6 +119,21 @@ class Context {
 
   cl_command_queue queue() const { return command_queue; }
 
+  std::string device_info(cl_device_info param) const {
+    size_t length;
+    cl_int status = clGetDeviceInfo(device, param, 0, NULL, &length);
+    if (status != CL_SUCCESS) {
+      throw std::runtime_error("failure in clGetDeviceInfo");
+    }
+    std::string info(length, '\0');
+    status = clGetDeviceInfo(device, param, length, &info[0], NULL);
+    if (status != CL_SUCCESS) {
+      throw std::runtime_error("failure in clGetDeviceInfo");
+    }
+    // drop the terminating null character
+    return info.c_str();
+  }
+
   ~Context() {
     if (is_active) release();
   }
@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+# Copyright (C) Codeplay Software Limited
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+""" Compares two benchmark result files written with --output-format=json or
+--output-format=csv and exits with a non-zero status when any benchmark is
+slower than the baseline by more than the threshold.
+
+Usage: compare_results.py baseline.json current.json [--threshold 5]
+                          [--metric p50_ns] [--ignore-noisy]
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import json
+import sys
+
+KEY_FIELDS = ("routine", "type", "shape", "stride")
+CONTEXT_FIELDS = ("library", "device", "vendor", "driver")
+
+
+def load_results(path):
+    """ Returns the context and a dictionary of the runs of a result file,
+        keyed by routine, type, shape and stride. """
+    with open(path) as f:
+        text = f.read()
+    if text.lstrip().startswith("{"):
+        document = json.loads(text)
+        context = document.get("context", {})
+        runs = document.get("benchmarks", [])
+    else:
+        # the CSV output repeats the context on every row
+        runs = list(csv.DictReader(text.splitlines()))
+        context = dict((k, runs[0][k]) for k in CONTEXT_FIELDS
+                       if runs and k in runs[0])
+    results = {}
+    for run in runs:
+        key = tuple(str(run[k]) for k in KEY_FIELDS)
+        results[key] = run
+    return context, results
+
+
+def is_noisy(run):
+    return str(run.get("noisy", "false")).lower() == "true"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed slowdown, in percent (default 5)")
+    parser.add_argument("--metric", default="p50_ns",
+                        help="time statistic to compare (default p50_ns)")
+    parser.add_argument("--ignore-noisy", action="store_true",
+                        help="do not fail on runs flagged as noisy")
+    args = parser.parse_args()
+
+    base_context, baseline = load_results(args.baseline)
+    curr_context, current = load_results(args.current)
+    for field in CONTEXT_FIELDS:
+        if base_context.get(field) != curr_context.get(field):
+            print("warning: %s differs: '%s' vs '%s'" %
+                  (field, base_context.get(field), curr_context.get(field)))
+
+    regressions = 0
+    print("%-40s %-28s %12s %12s %8s" %
+          ("benchmark", "shape", "baseline", "current", "change"))
+    for key in sorted(current):
+        if key not in baseline:
+            continue
+        base = float(baseline[key][args.metric])
+        curr = float(current[key][args.metric])
+        change = (curr - base) / base * 100.0 if base > 0 else 0.0
+        status = ""
+        if change > args.threshold:
+            noisy = is_noisy(baseline[key]) or is_noisy(current[key])
+            if noisy and args.ignore_noisy:
+                status = "noisy"
+            else:
+                status = "REGRESSION"
+                regressions += 1
+        print("%-40s %-28s %12.1f %12.1f %+7.1f%% %s" %
+              (key[0] + "_" + key[1], key[2], base, curr, change, status))
+
+    missing = sorted(set(baseline) - set(current))
+    for key in missing:
+        print("missing from %s: %s_%s %s" %
+              (args.current, key[0], key[1], key[2]))
+
+    if regressions:
+        print("%d regression(s) above %.1f%%" % (regressions, args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
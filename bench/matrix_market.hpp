@@ -0,0 +1,193 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename matrix_market.hpp
+ *
+ **************************************************************************/
+
+#ifndef MATRIX_MARKET_HPP
+#define MATRIX_MARKET_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/** csr_matrix.
+ * A sparse matrix in CSR format on the host, as taken by _spmv.
+ */
+template <typename ScalarT>
+struct csr_matrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<int> row_ptr{0};
+  std::vector<int> col_idx;
+  std::vector<ScalarT> val;
+
+  size_t nnz() const { return val.size(); }
+};
+
+/** sell_matrix.
+ * A sparse matrix in sliced ELLPACK format on the host, as taken by
+ * _spmv_sell.
+ */
+template <typename ScalarT>
+struct sell_matrix {
+  size_t rows = 0;
+  size_t cols = 0;
+  size_t slice_sz = 0;
+  std::vector<int> slice_ptr{0};
+  std::vector<int> col_idx;
+  std::vector<ScalarT> val;
+
+  size_t nnz() const { return val.size(); }
+};
+
+/** read_matrix_market.
+ * Reads a sparse matrix in the coordinate Matrix Market format, the one of the
+ * SuiteSparse collection: real, integer or pattern values, general or
+ * symmetric. The entries of pattern matrices are set to one. Throws
+ * std::runtime_error when the file cannot be read.
+ */
+template <typename ScalarT>
+csr_matrix<ScalarT> read_matrix_market(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) throw std::runtime_error("cannot open " + path);
+  std::string line;
+  std::getline(file, line);
+  std::transform(line.begin(), line.end(), line.begin(), ::tolower);
+  std::istringstream banner(line);
+  std::string head, object, format, field, symmetry;
+  banner >> head >> object >> format >> field >> symmetry;
+  if (head != "%%matrixmarket" || object != "matrix" ||
+      format != "coordinate" || field == "complex" ||
+      (symmetry != "general" && symmetry != "symmetric")) {
+    throw std::runtime_error(path + " is not a supported Matrix Market file");
+  }
+  const bool pattern = (field == "pattern");
+  const bool symmetric = (symmetry == "symmetric");
+  while (std::getline(file, line) && (line.empty() || line[0] == '%')) {
+  }
+  size_t rows, cols, entries;
+  std::istringstream(line) >> rows >> cols >> entries;
+
+  // the entries come in any order, they are sorted by row and column
+  std::vector<std::tuple<int, int, ScalarT>> coo;
+  coo.reserve(symmetric ? 2 * entries : entries);
+  for (size_t e = 0; e < entries; e++) {
+    size_t i, j;
+    double v = 1;
+    if (!(file >> i >> j) || (!pattern && !(file >> v))) {
+      throw std::runtime_error(path + " ends before its last entry");
+    }
+    coo.emplace_back(i - 1, j - 1, ScalarT(v));
+    if (symmetric && i != j) coo.emplace_back(j - 1, i - 1, ScalarT(v));
+  }
+  std::sort(coo.begin(), coo.end(),
+            [](const std::tuple<int, int, ScalarT> &a,
+               const std::tuple<int, int, ScalarT> &b) {
+              return std::make_pair(std::get<0>(a), std::get<1>(a)) <
+                     std::make_pair(std::get<0>(b), std::get<1>(b));
+            });
+
+  csr_matrix<ScalarT> a;
+  a.rows = rows;
+  a.cols = cols;
+  a.row_ptr.assign(rows + 1, 0);
+  for (auto &e : coo) {
+    a.row_ptr[std::get<0>(e) + 1]++;
+    a.col_idx.push_back(std::get<1>(e));
+    a.val.push_back(std::get<2>(e));
+  }
+  for (size_t i = 0; i < rows; i++) a.row_ptr[i + 1] += a.row_ptr[i];
+  return a;
+}
+
+/** laplacian_2d.
+ * The five point Laplacian of an n x n grid, with rows of five nonzeros at
+ * most, the matrix of the benchmarks run without a Matrix Market file.
+ */
+template <typename ScalarT>
+csr_matrix<ScalarT> laplacian_2d(size_t n) {
+  csr_matrix<ScalarT> a;
+  a.rows = a.cols = n * n;
+  for (size_t y = 0; y < n; y++) {
+    for (size_t x = 0; x < n; x++) {
+      const int row = y * n + x;
+      auto add = [&](int col, ScalarT v) {
+        a.col_idx.push_back(col);
+        a.val.push_back(v);
+      };
+      if (y > 0) add(row - int(n), ScalarT(-1));
+      if (x > 0) add(row - 1, ScalarT(-1));
+      add(row, ScalarT(4));
+      if (x + 1 < n) add(row + 1, ScalarT(-1));
+      if (y + 1 < n) add(row + int(n), ScalarT(-1));
+      a.row_ptr.push_back(a.col_idx.size());
+    }
+  }
+  return a;
+}
+
+/** to_sell.
+ * Converts a CSR matrix to sliced ELLPACK with slices of slice_sz rows. The
+ * padding repeats the last column of the row, or column 0 for empty rows,
+ * with a zero value.
+ */
+template <typename ScalarT>
+sell_matrix<ScalarT> to_sell(const csr_matrix<ScalarT> &a, size_t slice_sz) {
+  sell_matrix<ScalarT> s;
+  s.rows = a.rows;
+  s.cols = a.cols;
+  s.slice_sz = slice_sz;
+  const size_t n_slices = (a.rows + slice_sz - 1) / slice_sz;
+  for (size_t sl = 0; sl < n_slices; sl++) {
+    int len = 0;
+    for (size_t i = sl * slice_sz; i < std::min(a.rows, (sl + 1) * slice_sz);
+         i++) {
+      len = std::max(len, a.row_ptr[i + 1] - a.row_ptr[i]);
+    }
+    s.slice_ptr.push_back(s.slice_ptr.back() + len * slice_sz);
+  }
+  s.col_idx.assign(s.slice_ptr.back(), 0);
+  s.val.assign(s.slice_ptr.back(), ScalarT(0));
+  for (size_t i = 0; i < a.rows; i++) {
+    const size_t sl = i / slice_sz;
+    const size_t len = (s.slice_ptr[sl + 1] - s.slice_ptr[sl]) / slice_sz;
+    size_t pos = s.slice_ptr[sl] + i % slice_sz;
+    int col = 0;
+    for (size_t k = 0; k < len; k++, pos += slice_sz) {
+      const size_t e = a.row_ptr[i] + k;
+      if (e < size_t(a.row_ptr[i + 1])) {
+        col = a.col_idx[e];
+        s.val[pos] = a.val[e];
+      }
+      s.col_idx[pos] = col;
+    }
+  }
+  return s;
+}
+
+#endif  // MATRIX_MARKET_HPP
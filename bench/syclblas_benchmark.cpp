@@ -24,8 +24,14 @@
  **************************************************************************/
 
 #include "blas_benchmark.hpp"
+#include "matrix_market.hpp"
+#include "syclblas_benchmark_queue.hpp"
+
+#include <cstdlib>
 
 #include <interface/blas1_interface_sycl.hpp>
+#include <interface/blas2_interface_sycl.hpp>
+#include <interface/blas3_interface_sycl.hpp>
 
 using namespace blas;
 
@@ -33,52 +39,77 @@ template <typename ExecutorType = SYCL>
 class SyclBlasBenchmarker {
   cl::sycl::queue q;
   Executor<ExecutorType> ex;
+  std::string matrix_file;
 
  public:
-  SyclBlasBenchmarker()
-      : q(cl::sycl::default_selector(),
-          [=](cl::sycl::exception_list eL) {
-            for (auto &e : eL) {
-              try {
-                std::rethrow_exception(e);
-              } catch (cl::sycl::exception &e) {
-                std::cout << " E " << e.what() << std::endl;
-              } catch (...) {
-                std::cout << " An exception " << std::endl;
-              }
-            }
-          }),
-        ex(q) {}
+  explicit SyclBlasBenchmarker(const std::string &device,
+                               const std::string &matrix = "")
+      : q(make_benchmark_queue(device)), ex(q), matrix_file(matrix) {
+    calibrate_roofline();
+  }
+
+  /*! calibrate_roofline.
+   * Runs a STREAM-like copy through the executor and records the best
+   * bandwidth it reaches as the peak every other benchmark is compared to.
+   */
+  void calibrate_roofline(size_t size = 1 << 24) {
+    using ScalarT = float;
+    ScalarT *v1 = new_data<ScalarT>(size);
+    auto inx = ex.template allocate<ScalarT>(size);
+    auto iny = ex.template allocate<ScalarT>(size);
+    ex.copy_to_device(v1, inx, size);
+
+    const size_t bytes = size * 2 * sizeof(ScalarT);
+    auto result = benchmark<>::measure(10, 0, bytes, [&]() {
+      _copy(ex, size, inx, 1, iny, 1);
+      ex.sycl_queue().wait_and_throw();
+    });
+    const double peak = double(bytes) / (result.stats.min * 1e-9);
+    device_roofline::get().peak_bytes_per_second = peak;
+    benchmark_output::get().set_context("peak_copy_gbps",
+                                        std::to_string(peak * 1e-9));
+
+    ex.template deallocate<ScalarT>(inx);
+    ex.template deallocate<ScalarT>(iny);
+    release_data(v1);
+  }
 
   BENCHMARK_FUNCTION(scal_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
     ScalarT alpha(2.4367453465);
-    double flops;
-    auto in = ex.template allocate<ScalarT>(size);
-    ex.copy_to_device(v1, in, size);
-    flops = benchmark<>::measure(no_reps, size * 1, [&]() {
-      _scal(ex, size, alpha, in, 1);
+    benchmark_result result;
+    auto in = ex.template allocate<ScalarT>(len);
+    ex.copy_to_device(v1, in, len);
+    auto in_base = strided_base(in, size, stride);
+    const size_t bytes = size * 2 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 1, bytes, [&]() {
+      _scal(ex, size, alpha, in_base, stride);
       ex.sycl_queue().wait_and_throw();
     });
     ex.template deallocate<ScalarT>(in);
     release_data(v1);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(axpy_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
-    ScalarT *v2 = new_data<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    ScalarT *v2 = new_data<ScalarT>(len);
     ScalarT alpha(2.4367453465);
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
-    auto iny = ex.template allocate<ScalarT>(size);
-    ex.copy_to_device(v1, inx, size);
-    ex.copy_to_device(v2, iny, size);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
+    auto iny = ex.template allocate<ScalarT>(len);
+    ex.copy_to_device(v1, inx, len);
+    ex.copy_to_device(v2, iny, len);
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _axpy(ex, size, alpha, inx, 1, iny, 1);
+    auto inx_base = strided_base(inx, size, stride);
+    auto iny_base = strided_base(iny, size, stride);
+    const size_t bytes = size * 3 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _axpy(ex, size, alpha, inx_base, stride, iny_base, stride);
       ex.sycl_queue().wait_and_throw();
     });
 
@@ -86,62 +117,72 @@ class SyclBlasBenchmarker {
     ex.template deallocate<ScalarT>(iny);
     release_data(v1);
     release_data(v2);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(asum_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
     ScalarT vr;
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
     auto inr = ex.template allocate<ScalarT>(1);
-    ex.copy_to_device(v1, inx, size);
+    ex.copy_to_device(v1, inx, len);
     ex.copy_to_device(&vr, inr, 1);
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _asum(ex, size, inx, 1, inr);
+    auto inx_base = strided_base(inx, size, stride);
+    const size_t bytes = size * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _asum(ex, size, inx_base, stride, inr);
       ex.sycl_queue().wait_and_throw();
     });
 
     ex.template deallocate<ScalarT>(inx);
     ex.template deallocate<ScalarT>(inr);
     release_data(v1);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(nrm2_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
     auto inr = ex.template allocate<ScalarT>(1);
-    ex.copy_to_device(v1, inx, size);
+    ex.copy_to_device(v1, inx, len);
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _nrm2(ex, size, inx, 1, inr);
+    auto inx_base = strided_base(inx, size, stride);
+    const size_t bytes = size * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _nrm2(ex, size, inx_base, stride, inr);
       ex.sycl_queue().wait_and_throw();
     });
 
     ex.template deallocate<ScalarT>(inx);
     ex.template deallocate<ScalarT>(inr);
     release_data(v1);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(dot_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
-    ScalarT *v2 = new_data<ScalarT>(size);
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
-    auto iny = ex.template allocate<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    ScalarT *v2 = new_data<ScalarT>(len);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
+    auto iny = ex.template allocate<ScalarT>(len);
     auto inr = ex.template allocate<ScalarT>(1);
-    ex.copy_to_device(v1, inx, size);
-    ex.copy_to_device(v2, iny, size);
+    ex.copy_to_device(v1, inx, len);
+    ex.copy_to_device(v2, iny, len);
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _dot(ex, size, inx, 1, iny, 1, inr);
+    auto inx_base = strided_base(inx, size, stride);
+    auto iny_base = strided_base(iny, size, stride);
+    const size_t bytes = size * 2 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _dot(ex, size, inx_base, stride, iny_base, stride, inr);
       ex.sycl_queue().wait_and_throw();
     });
 
@@ -150,62 +191,72 @@ class SyclBlasBenchmarker {
     ex.template deallocate<ScalarT>(inr);
     release_data(v1);
     release_data(v2);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(iamax_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
     auto outI = ex.template allocate<IndexValueTuple<ScalarT>>(1);
-    ex.copy_to_device(v1, inx, size);
+    ex.copy_to_device(v1, inx, len);
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _iamax(ex, size, inx, 1, outI);
+    auto inx_base = strided_base(inx, size, stride);
+    const size_t bytes = size * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _iamax(ex, size, inx_base, stride, outI);
       ex.sycl_queue().wait_and_throw();
     });
 
     ex.template deallocate<ScalarT>(inx);
     ex.template deallocate<IndexValueTuple<ScalarT>>(outI);
     release_data(v1);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(iamin_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
-    auto inx = ex.template allocate<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    auto inx = ex.template allocate<ScalarT>(len);
     auto outI = ex.template allocate<IndexValueTuple<ScalarT>>(1);
-    ex.copy_to_device(v1, inx, size);
-    double flops;
+    ex.copy_to_device(v1, inx, len);
+    benchmark_result result;
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _iamin(ex, size, inx, 1, outI);
+    auto inx_base = strided_base(inx, size, stride);
+    const size_t bytes = size * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _iamin(ex, size, inx_base, stride, outI);
       ex.sycl_queue().wait_and_throw();
     });
 
     ex.template deallocate<ScalarT>(inx);
     ex.template deallocate<IndexValueTuple<ScalarT>>(outI);
     release_data(v1);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(scal2op_bench) {
     using ScalarT = TypeParam;
+    const size_t len = size * std::abs(stride);
     ScalarT alpha(2.4367453465);
-    ScalarT *v1 = new_data<ScalarT>(size);
-    ScalarT *v2 = new_data<ScalarT>(size);
-    double flops;
+    ScalarT *v1 = new_data<ScalarT>(len);
+    ScalarT *v2 = new_data<ScalarT>(len);
+    benchmark_result result;
 
-    auto inx = ex.template allocate<ScalarT>(size);
-    auto iny = ex.template allocate<ScalarT>(size);
-    ex.copy_to_device(v1, inx, size);
-    ex.copy_to_device(v2, iny, size);
+    auto inx = ex.template allocate<ScalarT>(len);
+    auto iny = ex.template allocate<ScalarT>(len);
+    ex.copy_to_device(v1, inx, len);
+    ex.copy_to_device(v2, iny, len);
 
-    flops = benchmark<>::measure(no_reps, size * 2, [&]() {
-      _scal(ex, size, alpha, inx, 1);
-      _scal(ex, size, alpha, iny, 1);
+    auto inx_base = strided_base(inx, size, stride);
+    auto iny_base = strided_base(iny, size, stride);
+    const size_t bytes = size * 4 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _scal(ex, size, alpha, inx_base, stride);
+      _scal(ex, size, alpha, iny_base, stride);
       ex.sycl_queue().wait_and_throw();
     });
 
@@ -213,27 +264,32 @@ class SyclBlasBenchmarker {
     ex.template deallocate<ScalarT>(iny);
     release_data(v1);
     release_data(v2);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(scal3op_bench) {
     using ScalarT = TypeParam;
+    const size_t len = size * std::abs(stride);
     ScalarT alpha(2.4367453465);
-    ScalarT *v1 = new_data<ScalarT>(size);
-    ScalarT *v2 = new_data<ScalarT>(size);
-    ScalarT *v3 = new_data<ScalarT>(size);
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
-    auto iny = ex.template allocate<ScalarT>(size);
-    auto inz = ex.template allocate<ScalarT>(size);
-    ex.copy_to_device(v1, inx, size);
-    ex.copy_to_device(v2, iny, size);
-    ex.copy_to_device(v3, inz, size);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    ScalarT *v2 = new_data<ScalarT>(len);
+    ScalarT *v3 = new_data<ScalarT>(len);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
+    auto iny = ex.template allocate<ScalarT>(len);
+    auto inz = ex.template allocate<ScalarT>(len);
+    ex.copy_to_device(v1, inx, len);
+    ex.copy_to_device(v2, iny, len);
+    ex.copy_to_device(v3, inz, len);
 
-    flops = benchmark<>::measure(no_reps, size * 3, [&]() {
-      _scal(ex, size, alpha, inx, 1);
-      _scal(ex, size, alpha, iny, 1);
-      _scal(ex, size, alpha, inz, 1);
+    auto inx_base = strided_base(inx, size, stride);
+    auto iny_base = strided_base(iny, size, stride);
+    auto inz_base = strided_base(inz, size, stride);
+    const size_t bytes = size * 6 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 3, bytes, [&]() {
+      _scal(ex, size, alpha, inx_base, stride);
+      _scal(ex, size, alpha, iny_base, stride);
+      _scal(ex, size, alpha, inz_base, stride);
       ex.sycl_queue().wait_and_throw();
     });
 
@@ -243,38 +299,46 @@ class SyclBlasBenchmarker {
     ex.template deallocate<ScalarT>(inx);
     ex.template deallocate<ScalarT>(iny);
     ex.template deallocate<ScalarT>(inz);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(axpy3op_bench) {
     using ScalarT = TypeParam;
+    const size_t len = size * std::abs(stride);
     std::array<ScalarT, 3> alphas = {1.78426458744, 2.187346575843,
                                      3.78164387328};
-    ScalarT *vsrc1 = new_data<ScalarT>(size);
-    ScalarT *vsrc2 = new_data<ScalarT>(size);
-    ScalarT *vsrc3 = new_data<ScalarT>(size);
-    ScalarT *vdst1 = new_data<ScalarT>(size);
-    ScalarT *vdst2 = new_data<ScalarT>(size);
-    ScalarT *vdst3 = new_data<ScalarT>(size);
-    double flops;
-
-    auto insrc1 = ex.template allocate<ScalarT>(size);
-    auto indst1 = ex.template allocate<ScalarT>(size);
-    auto insrc2 = ex.template allocate<ScalarT>(size);
-    auto indst2 = ex.template allocate<ScalarT>(size);
-    auto insrc3 = ex.template allocate<ScalarT>(size);
-    auto indst3 = ex.template allocate<ScalarT>(size);
-    ex.copy_to_device(vsrc1, insrc1, size);
-    ex.copy_to_device(vdst1, indst1, size);
-    ex.copy_to_device(vsrc2, insrc2, size);
-    ex.copy_to_device(vdst2, indst2, size);
-    ex.copy_to_device(vsrc3, insrc3, size);
-    ex.copy_to_device(vdst3, indst3, size);
-
-    flops = benchmark<>::measure(no_reps, size * 3 * 2, [&]() {
-      _axpy(ex, size, alphas[0], insrc1, 1, indst1, 1);
-      _axpy(ex, size, alphas[1], insrc2, 1, indst2, 1);
-      _axpy(ex, size, alphas[2], insrc3, 1, indst3, 1);
+    ScalarT *vsrc1 = new_data<ScalarT>(len);
+    ScalarT *vsrc2 = new_data<ScalarT>(len);
+    ScalarT *vsrc3 = new_data<ScalarT>(len);
+    ScalarT *vdst1 = new_data<ScalarT>(len);
+    ScalarT *vdst2 = new_data<ScalarT>(len);
+    ScalarT *vdst3 = new_data<ScalarT>(len);
+    benchmark_result result;
+
+    auto insrc1 = ex.template allocate<ScalarT>(len);
+    auto indst1 = ex.template allocate<ScalarT>(len);
+    auto insrc2 = ex.template allocate<ScalarT>(len);
+    auto indst2 = ex.template allocate<ScalarT>(len);
+    auto insrc3 = ex.template allocate<ScalarT>(len);
+    auto indst3 = ex.template allocate<ScalarT>(len);
+    ex.copy_to_device(vsrc1, insrc1, len);
+    ex.copy_to_device(vdst1, indst1, len);
+    ex.copy_to_device(vsrc2, insrc2, len);
+    ex.copy_to_device(vdst2, indst2, len);
+    ex.copy_to_device(vsrc3, insrc3, len);
+    ex.copy_to_device(vdst3, indst3, len);
+
+    auto insrc1_base = strided_base(insrc1, size, stride);
+    auto indst1_base = strided_base(indst1, size, stride);
+    auto insrc2_base = strided_base(insrc2, size, stride);
+    auto indst2_base = strided_base(indst2, size, stride);
+    auto insrc3_base = strided_base(insrc3, size, stride);
+    auto indst3_base = strided_base(indst3, size, stride);
+    const size_t bytes = size * 9 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 3 * 2, bytes, [&]() {
+      _axpy(ex, size, alphas[0], insrc1_base, stride, indst1_base, stride);
+      _axpy(ex, size, alphas[1], insrc2_base, stride, indst2_base, stride);
+      _axpy(ex, size, alphas[2], insrc3_base, stride, indst3_base, stride);
       ex.sycl_queue().wait_and_throw();
     });
 
@@ -290,32 +354,36 @@ class SyclBlasBenchmarker {
     release_data(vdst1);
     release_data(vdst2);
     release_data(vdst3);
-    return flops;
+    return result;
   }
 
   BENCHMARK_FUNCTION(blas1_bench) {
     using ScalarT = TypeParam;
-    ScalarT *v1 = new_data<ScalarT>(size);
-    ScalarT *v2 = new_data<ScalarT>(size);
+    const size_t len = size * std::abs(stride);
+    ScalarT *v1 = new_data<ScalarT>(len);
+    ScalarT *v2 = new_data<ScalarT>(len);
     ScalarT alpha(3.135345123);
-    double flops;
-    auto inx = ex.template allocate<ScalarT>(size);
-    auto iny = ex.template allocate<ScalarT>(size);
+    benchmark_result result;
+    auto inx = ex.template allocate<ScalarT>(len);
+    auto iny = ex.template allocate<ScalarT>(len);
     auto inr1 = ex.template allocate<ScalarT>(1);
     auto inr2 = ex.template allocate<ScalarT>(1);
     auto inr3 = ex.template allocate<ScalarT>(1);
     auto inr4 = ex.template allocate<ScalarT>(1);
     auto inrI = ex.template allocate<IndexValueTuple<ScalarT>>(1);
-    ex.copy_to_device(v1, inx, size);
-    ex.copy_to_device(v2, iny, size);
+    ex.copy_to_device(v1, inx, len);
+    ex.copy_to_device(v2, iny, len);
 
-    flops = benchmark<>::measure(no_reps, size * 12, [&]() {
-      _axpy(ex, size, alpha, inx, 1, iny, 1);
-      _asum(ex, size, iny, 1, inr1);
-      _dot(ex, size, inx, 1, iny, 1, inr2);
-      _nrm2(ex, size, iny, 1, inr3);
-      _iamax(ex, size, iny, 1, inrI);
-      _dot(ex, size, inx, 1, iny, 1, inr4);
+    auto inx_base = strided_base(inx, size, stride);
+    auto iny_base = strided_base(iny, size, stride);
+    const size_t bytes = size * 10 * sizeof(ScalarT);
+    result = benchmark<>::measure(no_reps, size * 12, bytes, [&]() {
+      _axpy(ex, size, alpha, inx_base, stride, iny_base, stride);
+      _asum(ex, size, iny_base, stride, inr1);
+      _dot(ex, size, inx_base, stride, iny_base, stride, inr2);
+      _nrm2(ex, size, iny_base, stride, inr3);
+      _iamax(ex, size, iny_base, stride, inrI);
+      _dot(ex, size, inx_base, stride, iny_base, stride, inr4);
       ex.sycl_queue().wait_and_throw();
     });
 
@@ -328,39 +396,925 @@ class SyclBlasBenchmarker {
     ex.template deallocate<IndexValueTuple<ScalarT>>(inrI);
     release_data(v1);
     release_data(v2);
-    return flops;
+    return result;
+  }
+
+  /*! copy_to_device_bench.
+   * Blocking host to device transfer through the executor.
+   */
+  BENCHMARK_FUNCTION(copy_to_device_bench) {
+    using ScalarT = TypeParam;
+    ScalarT *v1 = new_data<ScalarT>(size);
+    auto inx = ex.template allocate<ScalarT>(size);
+
+    const size_t bytes = size * sizeof(ScalarT);
+    auto result = benchmark<>::measure(
+        no_reps, 0, bytes, [&]() { ex.copy_to_device(v1, inx, size); });
+
+    ex.template deallocate<ScalarT>(inx);
+    release_data(v1);
+    return result;
+  }
+
+  /*! copy_to_host_bench.
+   * Blocking device to host transfer through the executor.
+   */
+  BENCHMARK_FUNCTION(copy_to_host_bench) {
+    using ScalarT = TypeParam;
+    ScalarT *v1 = new_data<ScalarT>(size);
+    auto inx = ex.template allocate<ScalarT>(size);
+    ex.copy_to_device(v1, inx, size);
+
+    const size_t bytes = size * sizeof(ScalarT);
+    auto result = benchmark<>::measure(
+        no_reps, 0, bytes, [&]() { ex.copy_to_host(inx, v1, size); });
+
+    ex.template deallocate<ScalarT>(inx);
+    release_data(v1);
+    return result;
+  }
+
+  /*! copy_overlap_bench.
+   * An _axpy followed by the upload of an unrelated vector. The transfer
+   * only overlaps the kernel if the runtime schedules them concurrently, so
+   * comparing with axpy_bench + copy_to_device_bench shows what the waits in
+   * copy_to_device cost.
+   */
+  BENCHMARK_FUNCTION(copy_overlap_bench) {
+    using ScalarT = TypeParam;
+    ScalarT *v1 = new_data<ScalarT>(size);
+    ScalarT alpha(2.4367453465);
+    auto inx = ex.template allocate<ScalarT>(size);
+    auto iny = ex.template allocate<ScalarT>(size);
+    auto inz = ex.template allocate<ScalarT>(size);
+    ex.copy_to_device(v1, inx, size);
+    ex.copy_to_device(v1, iny, size);
+
+    const size_t bytes = size * 4 * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _axpy(ex, size, alpha, inx, 1, iny, 1);
+      ex.copy_to_device(v1, inz, size);
+      ex.sycl_queue().wait_and_throw();
+    });
+
+    ex.template deallocate<ScalarT>(inx);
+    ex.template deallocate<ScalarT>(iny);
+    ex.template deallocate<ScalarT>(inz);
+    release_data(v1);
+    return result;
+  }
+
+  /*! cold_axpy_bench.
+   * The first _axpy on freshly allocated and uploaded vectors; only the
+   * kernel is timed, the allocation and the uploads are not.
+   */
+  BENCHMARK_FUNCTION(cold_axpy_bench) {
+    using ScalarT = TypeParam;
+    ScalarT *v1 = new_data<ScalarT>(size);
+    ScalarT alpha(2.4367453465);
+    std::vector<double> first_kernel;
+
+    const size_t bytes = size * 3 * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      auto inx = ex.template allocate<ScalarT>(size);
+      auto iny = ex.template allocate<ScalarT>(size);
+      ex.copy_to_device(v1, inx, size);
+      ex.copy_to_device(v1, iny, size);
+      auto start = std::chrono::steady_clock::now();
+      _axpy(ex, size, alpha, inx, 1, iny, 1);
+      ex.sycl_queue().wait_and_throw();
+      auto end = std::chrono::steady_clock::now();
+      first_kernel.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+      ex.template deallocate<ScalarT>(inx);
+      ex.template deallocate<ScalarT>(iny);
+    });
+
+    release_data(v1);
+    return replace_samples(result, first_kernel);
+  }
+
+  /*! cold_e2e_bench.
+   * End-to-end _axpy as an application without resident data sees it:
+   * allocation, uploads, kernel, download and release. The bytes are those
+   * transferred between the host and the device.
+   */
+  BENCHMARK_FUNCTION(cold_e2e_bench) {
+    using ScalarT = TypeParam;
+    ScalarT *v1 = new_data<ScalarT>(size);
+    ScalarT *v2 = new_data<ScalarT>(size, false);
+    ScalarT alpha(2.4367453465);
+
+    const size_t bytes = size * 3 * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      auto inx = ex.template allocate<ScalarT>(size);
+      auto iny = ex.template allocate<ScalarT>(size);
+      ex.copy_to_device(v1, inx, size);
+      ex.copy_to_device(v1, iny, size);
+      _axpy(ex, size, alpha, inx, 1, iny, 1);
+      ex.copy_to_host(iny, v2, size);
+      ex.template deallocate<ScalarT>(inx);
+      ex.template deallocate<ScalarT>(iny);
+    });
+
+    release_data(v1);
+    release_data(v2);
+    return result;
+  }
+
+  /*! batched_problem.
+   * Device copies of the operands of `batch` independent BLAS2/BLAS3
+   * problems, all initialised from the same host data.
+   */
+  template <typename ScalarT>
+  struct batched_problem {
+    Executor<ExecutorType> &ex;
+    std::vector<std::vector<ScalarT *>> operands;
+
+    batched_problem(Executor<ExecutorType> &ex_, size_t batch,
+                    std::vector<size_t> sizes)
+        : ex(ex_), operands(sizes.size()) {
+      for (size_t op = 0; op < sizes.size(); op++) {
+        ScalarT *host = new_data<ScalarT>(sizes[op]);
+        for (size_t i = 0; i < batch; i++) {
+          operands[op].push_back(ex.template allocate<ScalarT>(sizes[op]));
+          ex.copy_to_device(host, operands[op].back(), sizes[op]);
+        }
+        release_data(host);
+      }
+    }
+
+    ~batched_problem() {
+      for (auto &op : operands) {
+        for (auto ptr : op) ex.template deallocate<ScalarT>(ptr);
+      }
+    }
+
+    ScalarT *operator()(size_t op, size_t i) { return operands[op][i]; }
+  };
+
+  /*! gemv_bench_impl.
+   * y = alpha * op(A) * x + beta * y on `batch` M x N problems.
+   */
+  template <typename ScalarT>
+  benchmark_result gemv_bench_impl(size_t no_reps, char trans, size_t m,
+                                   size_t n, size_t batch = 1) {
+    ScalarT alpha(1.5), beta(0.5);
+    const size_t len_x = (trans == 'n') ? n : m;
+    const size_t len_y = (trans == 'n') ? m : n;
+    batched_problem<ScalarT> p(ex, batch, {m * n, len_x, len_y});
+
+    const size_t flops = 2 * m * n * batch;
+    const size_t bytes = (m * n + len_x + 2 * len_y) * batch * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      for (size_t i = 0; i < batch; i++) {
+        _gemv(ex, trans, m, n, alpha, p(0, i), m, p(1, i), 1, beta, p(2, i),
+              1);
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = std::string("trans=") + trans + ",m=" + std::to_string(m) +
+                   ",n=" + std::to_string(n) +
+                   ",batch=" + std::to_string(batch);
+    return result;
+  }
+
+  /*! ger_bench_impl.
+   * A = alpha * x * y' + A on `batch` M x N problems.
+   */
+  template <typename ScalarT>
+  benchmark_result ger_bench_impl(size_t no_reps, size_t m, size_t n,
+                                  size_t batch = 1) {
+    ScalarT alpha(1.5);
+    batched_problem<ScalarT> p(ex, batch, {m * n, m, n});
+
+    const size_t flops = 2 * m * n * batch;
+    const size_t bytes = (2 * m * n + m + n) * batch * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      for (size_t i = 0; i < batch; i++) {
+        _ger(ex, m, n, alpha, p(1, i), 1, p(2, i), 1, p(0, i), m);
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = "m=" + std::to_string(m) + ",n=" + std::to_string(n) +
+                   ",batch=" + std::to_string(batch);
+    return result;
+  }
+
+  /*! gemm_bench_impl.
+   * C = alpha * op(A) * op(B) + beta * C on `batch` M x N x K problems,
+   * calling gemm(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc)
+   * so the same driver measures _gemm and each explicit tile configuration.
+   */
+  template <typename ScalarT, typename GemmT>
+  benchmark_result gemm_bench_impl(size_t no_reps, char ta, char tb, size_t m,
+                                   size_t n, size_t k, size_t batch,
+                                   GemmT gemm) {
+    ScalarT alpha(1.5), beta(0.5);
+    const size_t lda = (ta == 'n') ? m : k;
+    const size_t ldb = (tb == 'n') ? k : n;
+    batched_problem<ScalarT> p(ex, batch, {m * k, k * n, m * n});
+
+    const size_t flops = 2 * m * n * k * batch;
+    const size_t bytes = (m * k + k * n + 2 * m * n) * batch * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      for (size_t i = 0; i < batch; i++) {
+        gemm(ta, tb, m, n, k, alpha, p(0, i), lda, p(1, i), ldb, beta, p(2, i),
+             m);
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = std::string("trans=") + ta + tb + ",m=" +
+                   std::to_string(m) + ",n=" + std::to_string(n) + ",k=" +
+                   std::to_string(k) + ",batch=" + std::to_string(batch);
+    return result;
+  }
+
+  template <typename ScalarT>
+  benchmark_result gemm_bench_impl(size_t no_reps, char ta, char tb, size_t m,
+                                   size_t n, size_t k, size_t batch = 1) {
+    return gemm_bench_impl<ScalarT>(
+        no_reps, ta, tb, m, n, k, batch,
+        [&](char ta, char tb, size_t m, size_t n, size_t k, ScalarT alpha,
+            ScalarT *a, size_t lda, ScalarT *b, size_t ldb, ScalarT beta,
+            ScalarT *c, size_t ldc) {
+          _gemm(ex, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+        });
+  }
+
+  // Shapes of the BLAS2/BLAS3 benchmarks: square problems grow every
+  // dimension with the size, tall-skinny problems only grow the rows against
+  // a fixed skinny_dim, and batched-small problems run `size` small_dim-sized
+  // problems back to back.
+  static constexpr size_t skinny_dim = 64;
+  static constexpr size_t small_dim = 32;
+
+  BENCHMARK_FUNCTION(gemv_n_square_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 'n', size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemv_t_square_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 't', size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemv_n_tallskinny_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 'n', size, skinny_dim);
+  }
+
+  BENCHMARK_FUNCTION(gemv_t_tallskinny_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 't', size, skinny_dim);
+  }
+
+  BENCHMARK_FUNCTION(gemv_n_batched_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 'n', small_dim, small_dim,
+                                      size);
+  }
+
+  BENCHMARK_FUNCTION(gemv_t_batched_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 't', small_dim, small_dim,
+                                      size);
+  }
+
+  BENCHMARK_FUNCTION(ger_square_bench) {
+    return ger_bench_impl<TypeParam>(no_reps, size, size);
+  }
+
+  BENCHMARK_FUNCTION(ger_tallskinny_bench) {
+    return ger_bench_impl<TypeParam>(no_reps, size, skinny_dim);
+  }
+
+  BENCHMARK_FUNCTION(ger_batched_bench) {
+    return ger_bench_impl<TypeParam>(no_reps, small_dim, small_dim, size);
+  }
+
+  /*! sparse_problem.
+   * The matrix of the sparse benchmarks: the Matrix Market file given with
+   * --matrix, whatever the size, or else the Laplacian of a size x size grid.
+   */
+  template <typename ScalarT>
+  csr_matrix<ScalarT> sparse_problem(size_t size) {
+    return matrix_file.empty() ? laplacian_2d<ScalarT>(size)
+                               : read_matrix_market<ScalarT>(matrix_file);
+  }
+
+  template <typename ScalarT>
+  std::string sparse_shape(const csr_matrix<ScalarT> &a) {
+    return "m=" + std::to_string(a.rows) + ",n=" + std::to_string(a.cols) +
+           ",nnz=" + std::to_string(a.nnz());
+  }
+
+  /*! spmv_csr_bench.
+   * y = alpha * A * x + beta * y with A in CSR format, through _spmv.
+   */
+  BENCHMARK_FUNCTION(spmv_csr_bench) {
+    using ScalarT = TypeParam;
+    ScalarT alpha(1.5), beta(0.5);
+    auto a = sparse_problem<ScalarT>(size);
+    ScalarT *v1 = new_data<ScalarT>(a.cols);
+    ScalarT *v2 = new_data<ScalarT>(a.rows);
+    auto row_ptr = ex.template allocate<int>(a.rows + 1);
+    auto col_idx = ex.template allocate<int>(a.nnz());
+    auto val = ex.template allocate<ScalarT>(a.nnz());
+    auto inx = ex.template allocate<ScalarT>(a.cols);
+    auto iny = ex.template allocate<ScalarT>(a.rows);
+    ex.copy_to_device(a.row_ptr.data(), row_ptr, a.rows + 1);
+    ex.copy_to_device(a.col_idx.data(), col_idx, a.nnz());
+    ex.copy_to_device(a.val.data(), val, a.nnz());
+    ex.copy_to_device(v1, inx, a.cols);
+    ex.copy_to_device(v2, iny, a.rows);
+
+    const size_t flops = 2 * a.nnz();
+    const size_t bytes = a.nnz() * (sizeof(ScalarT) + sizeof(int)) +
+                         (a.rows + 1) * sizeof(int) +
+                         (a.cols + 2 * a.rows) * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      _spmv(ex, a.rows, a.cols, a.nnz(), alpha, row_ptr, col_idx, val, inx, 1,
+            beta, iny, 1);
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = sparse_shape(a);
+
+    ex.template deallocate<int>(row_ptr);
+    ex.template deallocate<int>(col_idx);
+    ex.template deallocate<ScalarT>(val);
+    ex.template deallocate<ScalarT>(inx);
+    ex.template deallocate<ScalarT>(iny);
+    release_data(v1);
+    release_data(v2);
+    return result;
+  }
+
+  /*! spmv_sell_bench.
+   * spmv_csr_bench with A in sliced ELLPACK format, slices of 32 rows,
+   * through _spmv_sell. The bytes count the padding.
+   */
+  BENCHMARK_FUNCTION(spmv_sell_bench) {
+    using ScalarT = TypeParam;
+    ScalarT alpha(1.5), beta(0.5);
+    auto csr = sparse_problem<ScalarT>(size);
+    auto a = to_sell(csr, 32);
+    const size_t n_slices = a.slice_ptr.size() - 1;
+    ScalarT *v1 = new_data<ScalarT>(a.cols);
+    ScalarT *v2 = new_data<ScalarT>(a.rows);
+    auto slice_ptr = ex.template allocate<int>(n_slices + 1);
+    auto col_idx = ex.template allocate<int>(a.nnz());
+    auto val = ex.template allocate<ScalarT>(a.nnz());
+    auto inx = ex.template allocate<ScalarT>(a.cols);
+    auto iny = ex.template allocate<ScalarT>(a.rows);
+    ex.copy_to_device(a.slice_ptr.data(), slice_ptr, n_slices + 1);
+    ex.copy_to_device(a.col_idx.data(), col_idx, a.nnz());
+    ex.copy_to_device(a.val.data(), val, a.nnz());
+    ex.copy_to_device(v1, inx, a.cols);
+    ex.copy_to_device(v2, iny, a.rows);
+
+    const size_t flops = 2 * csr.nnz();
+    const size_t bytes = a.nnz() * (sizeof(ScalarT) + sizeof(int)) +
+                         (n_slices + 1) * sizeof(int) +
+                         (a.cols + 2 * a.rows) * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      _spmv_sell(ex, a.rows, a.cols, a.slice_sz, a.nnz(), alpha, slice_ptr,
+                 col_idx, val, inx, 1, beta, iny, 1);
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = sparse_shape(csr);
+
+    ex.template deallocate<int>(slice_ptr);
+    ex.template deallocate<int>(col_idx);
+    ex.template deallocate<ScalarT>(val);
+    ex.template deallocate<ScalarT>(inx);
+    ex.template deallocate<ScalarT>(iny);
+    release_data(v1);
+    release_data(v2);
+    return result;
+  }
+
+  /*! spmv_dot_bench.
+   * The step of a CG solver, y = A * x and x . y, as _spmv followed by _dot
+   * or Fused in one expression tree.
+   */
+  template <class TypeParam, bool Fused>
+  benchmark_result spmv_dot_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    using RHS = vector_view<
+        ScalarT, typename Executor<ExecutorType>::template ContainerT<ScalarT>>;
+    using IDX = vector_view<
+        int, typename Executor<ExecutorType>::template ContainerT<int>>;
+    auto a = sparse_problem<ScalarT>(size);
+    ScalarT *v1 = new_data<ScalarT>(a.rows);
+    auto row_ptr = ex.template allocate<int>(a.rows + 1);
+    auto col_idx = ex.template allocate<int>(a.nnz());
+    auto val = ex.template allocate<ScalarT>(a.nnz());
+    auto inx = ex.template allocate<ScalarT>(a.rows);
+    auto iny = ex.template allocate<ScalarT>(a.rows);
+    auto inr = ex.template allocate<ScalarT>(1);
+    ex.copy_to_device(a.row_ptr.data(), row_ptr, a.rows + 1);
+    ex.copy_to_device(a.col_idx.data(), col_idx, a.nnz());
+    ex.copy_to_device(a.val.data(), val, a.nnz());
+    ex.copy_to_device(v1, inx, a.rows);
+
+    auto row_ptr_container = ex.get_buffer(row_ptr);
+    IDX my_row_ptr(row_ptr_container, ex.get_offset(row_ptr), 1, a.rows + 1);
+    auto col_idx_container = ex.get_buffer(col_idx);
+    IDX my_col_idx(col_idx_container, ex.get_offset(col_idx), 1, a.nnz());
+    auto val_container = ex.get_buffer(val);
+    RHS my_val(val_container, ex.get_offset(val), 1, a.nnz());
+    csr_view<IDX, IDX, RHS> my_a(my_row_ptr, my_col_idx, my_val, a.cols);
+    auto x_container = ex.get_buffer(inx);
+    RHS my_x(x_container, ex.get_offset(inx), 1, a.rows);
+    auto y_container = ex.get_buffer(iny);
+    RHS my_y(y_container, ex.get_offset(iny), 1, a.rows);
+    auto r_container = ex.get_buffer(inr);
+    RHS my_r(r_container, ex.get_offset(inr), 1, 1);
+    auto spmvOp = make_prdRowCsrVct(my_a, my_x);
+    auto assignOp = make_op<Assign>(my_y, spmvOp);
+    auto prdOp = make_op<BinaryOp, prdOp2_struct>(my_x, assignOp);
+    auto dotOp = make_addAssignReduction(my_r, prdOp, 256, 256 * 512);
+
+    const size_t flops = 2 * a.nnz() + 2 * a.rows;
+    const size_t bytes = a.nnz() * (sizeof(ScalarT) + sizeof(int)) +
+                         (a.rows + 1) * sizeof(int) +
+                         2 * a.rows * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      if (Fused) {
+        ex.reduce(dotOp);
+      } else {
+        _spmv(ex, a.rows, a.cols, a.nnz(), ScalarT(1), row_ptr, col_idx, val,
+              inx, 1, ScalarT(0), iny, 1);
+        _dot(ex, a.rows, inx, 1, iny, 1, inr);
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = sparse_shape(a);
+
+    ex.template deallocate<int>(row_ptr);
+    ex.template deallocate<int>(col_idx);
+    ex.template deallocate<ScalarT>(val);
+    ex.template deallocate<ScalarT>(inx);
+    ex.template deallocate<ScalarT>(iny);
+    ex.template deallocate<ScalarT>(inr);
+    release_data(v1);
+    return result;
+  }
+
+  /*! nrm2_matrix_bench.
+   * The norms of the columns of a size x size matrix, as a _nrm2 per column
+   * or Segmented in a single kernel by _nrm2_matrix.
+   */
+  template <class TypeParam, bool Segmented>
+  benchmark_result nrm2_matrix_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    batched_problem<ScalarT> p(ex, 1, {size * size, size});
+
+    const size_t flops = 2 * size * size;
+    const size_t bytes = (size * size + size) * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      if (Segmented) {
+        _nrm2_matrix(ex, 'c', size, size, p(0, 0), size, p(1, 0), 1);
+      } else {
+        for (size_t j = 0; j < size; j++) {
+          _nrm2(ex, size, p(0, 0) + j * size, 1, p(1, 0) + j);
+        }
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = "m=" + std::to_string(size) + ",n=" + std::to_string(size);
+    return result;
+  }
+
+  BENCHMARK_FUNCTION(gemm_nn_square_bench) {
+    return gemm_bench_impl<TypeParam>(no_reps, 'n', 'n', size, size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemm_nt_square_bench) {
+    return gemm_bench_impl<TypeParam>(no_reps, 'n', 't', size, size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemm_tn_square_bench) {
+    return gemm_bench_impl<TypeParam>(no_reps, 't', 'n', size, size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemm_tt_square_bench) {
+    return gemm_bench_impl<TypeParam>(no_reps, 't', 't', size, size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemm_nn_tallskinny_bench) {
+    return gemm_bench_impl<TypeParam>(no_reps, 'n', 'n', size, skinny_dim,
+                                      skinny_dim);
+  }
+
+  BENCHMARK_FUNCTION(gemm_nn_batched_bench) {
+    return gemm_bench_impl<TypeParam>(no_reps, 'n', 'n', small_dim, small_dim,
+                                      small_dim, size);
+  }
+
+  /*! gemm_tn_packed_bench.
+   * Square GEMM with a transposed A packed once, outside of the timed
+   * region, by _gemm_pack_a, as when the same weights multiply many inputs.
+   * Compare with gemm_tn_square.
+   */
+  BENCHMARK_FUNCTION(gemm_tn_packed_bench) {
+    using ScalarT = TypeParam;
+    ScalarT *a = new_data<ScalarT>(size * size);
+    auto a_gpu = ex.template allocate<ScalarT>(size * size);
+    auto a_packed = ex.template allocate<ScalarT>(
+        _gemm_packed_size_a<ScalarT>(ex, size, size));
+    ex.copy_to_device(a, a_gpu, size * size);
+    _gemm_pack_a(ex, 't', size, size, a_gpu, size, a_packed);
+    auto result = gemm_bench_impl<ScalarT>(
+        no_reps, 't', 'n', size, size, size, 1,
+        [&](char, char tb, size_t m, size_t n, size_t k, ScalarT alpha,
+            ScalarT *, size_t, ScalarT *b, size_t ldb, ScalarT beta,
+            ScalarT *c, size_t ldc) {
+          _gemm_compute(ex, tb, m, n, k, alpha, a_packed, b, ldb, beta, c,
+                        ldc);
+        });
+    ex.template deallocate<ScalarT>(a_gpu);
+    ex.template deallocate<ScalarT>(a_packed);
+    release_data(a);
+    return result;
+  }
+
+  /*! gemm_quantized_bench.
+   * Square non-transposed GEMM of uint8_t activations by int8_t weights into
+   * int8_t, with per-channel scales of type TypeParam. Compare with
+   * gemm_nn_square, the operands take 4 times less memory than in float.
+   */
+  BENCHMARK_FUNCTION(gemm_quantized_bench) {
+    using ScalarT = TypeParam;
+    auto a = ex.template allocate<uint8_t>(size * size);
+    auto b = ex.template allocate<int8_t>(size * size);
+    auto c = ex.template allocate<int8_t>(size * size);
+    auto s = ex.template allocate<ScalarT>(size);
+    std::vector<uint8_t> a_host(size * size);
+    std::vector<int8_t> b_host(size * size);
+    std::vector<ScalarT> s_host(size, ScalarT(1) / ScalarT(size));
+    for (auto &x : a_host) x = uint8_t(rand() % 256);
+    for (auto &x : b_host) x = int8_t(rand() % 255 - 127);
+    ex.copy_to_device(a_host.data(), a, size * size);
+    ex.copy_to_device(b_host.data(), b, size * size);
+    ex.copy_to_device(s_host.data(), s, size);
+
+    const size_t flops = 2 * size * size * size;
+    const size_t bytes = 3 * size * size + size * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      _gemm_quantized(ex, 'n', 'n', size, size, size, a, size, 128, b, size,
+                      0, s, true, c, size, 0);
+      ex.sycl_queue().wait_and_throw();
+    });
+    result.shape = "trans=nn,m=" + std::to_string(size) + ",n=" +
+                   std::to_string(size) + ",k=" + std::to_string(size);
+    ex.template deallocate<uint8_t>(a);
+    ex.template deallocate<int8_t>(b);
+    ex.template deallocate<int8_t>(c);
+    ex.template deallocate<ScalarT>(s);
+    return result;
+  }
+
+  /*! gemm_raster_bench.
+   * size x size x 256 GEMM, a shape whose A and B panels outgrow the last
+   * level cache, with the work groups walking C in the order of Raster.
+   */
+  template <class TypeParam, typename Raster>
+  benchmark_result gemm_raster_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    return gemm_bench_impl<ScalarT>(
+        no_reps, 'n', 'n', size, size, 256, 1,
+        [&](char, char, size_t m, size_t n, size_t k, ScalarT alpha,
+            ScalarT *a, size_t lda, ScalarT *b, size_t ldb, ScalarT beta,
+            ScalarT *c, size_t ldc) {
+          _select_gemm<128, false, false, false, 64, Tile<8, 8, 16, 16>, false,
+                       4, Raster>(ex, false, false, m, n, k, alpha, a, lda, b,
+                                  ldb, beta, c, ldc);
+        });
+  }
+
+  /*! gemm_strassen_bench.
+   * Square non-transposed GEMM through _gemm_strassen with Levels levels
+   * applied whatever the size, Levels = 0 being _gemm itself. The size from
+   * which one level beats none is the crossover to pass as _cutoff.
+   */
+  template <class TypeParam, int Levels>
+  benchmark_result gemm_strassen_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    return gemm_bench_impl<ScalarT>(
+        no_reps, 'n', 'n', size, size, size, 1,
+        [&](char ta, char tb, size_t m, size_t n, size_t k, ScalarT alpha,
+            ScalarT *a, size_t lda, ScalarT *b, size_t ldb, ScalarT beta,
+            ScalarT *c, size_t ldc) {
+          _gemm_strassen(ex, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c,
+                         ldc, Levels, size_t(1));
+        });
+  }
+
+  /*! gemm_tile_bench.
+   * Square non-transposed GEMM forcing one of the configurations _gemm
+   * dispatches to, so tuning changes can be measured independently of the
+   * device-based selection. Pipeline prefetches the next blocks of A and B
+   * into registers while the current ones are multiplied, VectorSize is the
+   * width of the global memory accesses of full tiles.
+   */
+  template <class TypeParam, int WgSize, bool DoubleBuffer, int ItemRows,
+            int ItemCols, int WgRows, int WgCols, bool Pipeline = false,
+            int VectorSize = 1>
+  benchmark_result gemm_tile_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    using TileT = Tile<ItemRows, ItemCols, WgRows, WgCols>;
+    return gemm_bench_impl<ScalarT>(
+        no_reps, 'n', 'n', size, size, size, 1,
+        [&](char, char, size_t m, size_t n, size_t k, ScalarT alpha,
+            ScalarT *a, size_t lda, ScalarT *b, size_t ldb, ScalarT beta,
+            ScalarT *c, size_t ldc) {
+          _select_gemm<WgSize, DoubleBuffer, false, false, 64, TileT,
+                       Pipeline, VectorSize>(ex, false, false, m, n, k, alpha,
+                                             a, lda, b, ldb, beta, c, ldc);
+        });
   }
 };
 
-BENCHMARK_MAIN_BEGIN(1 << 1, 1 << 24, 10);
-SyclBlasBenchmarker<SYCL> blasbenchmark;
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<SyclBlasBenchmarker<SYCL>> blasbenchmark([&]() {
+    return new SyclBlasBenchmarker<SYCL>(args.device, args.matrix);
+  });
+  benchmark_registry registry;
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "scal_float",
+                             benchmark_sizes(2, 1 << 24), scal_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "scal_double",
+                             benchmark_sizes(2, 1 << 24), scal_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "axpy_float",
+                             benchmark_sizes(2, 1 << 24), axpy_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "axpy_double",
+                             benchmark_sizes(2, 1 << 24), axpy_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "asum_float",
+                             benchmark_sizes(2, 1 << 24), asum_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "asum_double",
+                             benchmark_sizes(2, 1 << 24), asum_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "nrm2_float",
+                             benchmark_sizes(2, 1 << 24), nrm2_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "nrm2_double",
+                             benchmark_sizes(2, 1 << 24), nrm2_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "dot_float",
+                             benchmark_sizes(2, 1 << 24), dot_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "dot_double",
+                             benchmark_sizes(2, 1 << 24), dot_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "iamax_double",
+                             benchmark_sizes(2, 1 << 24), iamax_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "scal2op_float",
+                             benchmark_sizes(2, 1 << 24), scal2op_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "scal2op_double",
+                             benchmark_sizes(2, 1 << 24),
+                             scal2op_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "scal3op_float",
+                             benchmark_sizes(2, 1 << 24), scal3op_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "scal3op_double",
+                             benchmark_sizes(2, 1 << 24),
+                             scal3op_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "axpy3op_float",
+                             benchmark_sizes(2, 1 << 24), axpy3op_bench<float>);
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "axpy3op_double",
+                             benchmark_sizes(2, 1 << 24),
+                             axpy3op_bench<double>);
+
+  BENCHMARK_REGISTER_STRIDED(registry, blasbenchmark, "blas1_double",
+                             benchmark_sizes(2, 1 << 24), blas1_bench<double>);
 
-BENCHMARK_REGISTER_FUNCTION("scal_float", scal_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal_double", scal_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_to_device_float",
+                     benchmark_sizes(2, 1 << 24), copy_to_device_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_to_device_double",
+                     benchmark_sizes(2, 1 << 24), copy_to_device_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_to_host_float",
+                     benchmark_sizes(2, 1 << 24), copy_to_host_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_to_host_double",
+                     benchmark_sizes(2, 1 << 24), copy_to_host_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_overlap_float",
+                     benchmark_sizes(2, 1 << 24), copy_overlap_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_overlap_double",
+                     benchmark_sizes(2, 1 << 24), copy_overlap_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "cold_axpy_float",
+                     benchmark_sizes(2, 1 << 24), cold_axpy_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "cold_axpy_double",
+                     benchmark_sizes(2, 1 << 24), cold_axpy_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "cold_e2e_float",
+                     benchmark_sizes(2, 1 << 24), cold_e2e_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "cold_e2e_double",
+                     benchmark_sizes(2, 1 << 24), cold_e2e_bench<double>);
 
-BENCHMARK_REGISTER_FUNCTION("axpy_float", axpy_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("axpy_double", axpy_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_square_float",
+                     benchmark_sizes(64, 8192), gemv_n_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_square_double",
+                     benchmark_sizes(64, 8192), gemv_n_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_square_float",
+                     benchmark_sizes(64, 8192), gemv_t_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_square_double",
+                     benchmark_sizes(64, 8192), gemv_t_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_tallskinny_float",
+                     benchmark_sizes(1024, 1 << 20),
+                     gemv_n_tallskinny_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_tallskinny_double",
+                     benchmark_sizes(1024, 1 << 20),
+                     gemv_n_tallskinny_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_tallskinny_float",
+                     benchmark_sizes(1024, 1 << 20),
+                     gemv_t_tallskinny_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_tallskinny_double",
+                     benchmark_sizes(1024, 1 << 20),
+                     gemv_t_tallskinny_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_batched_float",
+                     benchmark_sizes(1, 256), gemv_n_batched_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_batched_double",
+                     benchmark_sizes(1, 256), gemv_n_batched_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_batched_float",
+                     benchmark_sizes(1, 256), gemv_t_batched_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_batched_double",
+                     benchmark_sizes(1, 256), gemv_t_batched_bench<double>);
 
-BENCHMARK_REGISTER_FUNCTION("asum_float", asum_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("asum_double", asum_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_square_float",
+                     benchmark_sizes(64, 8192), ger_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_square_double",
+                     benchmark_sizes(64, 8192), ger_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_tallskinny_float",
+                     benchmark_sizes(1024, 1 << 20),
+                     ger_tallskinny_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_tallskinny_double",
+                     benchmark_sizes(1024, 1 << 20),
+                     ger_tallskinny_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_batched_float",
+                     benchmark_sizes(1, 256), ger_batched_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_batched_double",
+                     benchmark_sizes(1, 256), ger_batched_bench<double>);
 
-BENCHMARK_REGISTER_FUNCTION("nrm2_float", nrm2_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("nrm2_double", nrm2_bench<double>);
+  // the size is the side of the grid of the Laplacian, unless --matrix is set
+  BENCHMARK_REGISTER(registry, blasbenchmark, "spmv_csr_float",
+                     benchmark_sizes(64, 2048), spmv_csr_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "spmv_csr_double",
+                     benchmark_sizes(64, 2048), spmv_csr_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "spmv_sell_float",
+                     benchmark_sizes(64, 2048), spmv_sell_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "spmv_sell_double",
+                     benchmark_sizes(64, 2048), spmv_sell_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "spmv_dot_float",
+                     benchmark_sizes(64, 2048), spmv_dot_bench<float, false>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "spmv_dot_fused_float",
+                     benchmark_sizes(64, 2048), spmv_dot_bench<float, true>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_columns_float",
+                     benchmark_sizes(64, 4096),
+                     nrm2_matrix_bench<float, false>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_matrix_float",
+                     benchmark_sizes(64, 4096), nrm2_matrix_bench<float, true>);
 
-BENCHMARK_REGISTER_FUNCTION("dot_float", dot_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("dot_double", dot_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nn_square_float",
+                     benchmark_sizes(64, 2048), gemm_nn_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nn_square_double",
+                     benchmark_sizes(64, 2048), gemm_nn_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nt_square_float",
+                     benchmark_sizes(64, 2048), gemm_nt_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nt_square_double",
+                     benchmark_sizes(64, 2048), gemm_nt_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tn_square_float",
+                     benchmark_sizes(64, 2048), gemm_tn_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tn_square_double",
+                     benchmark_sizes(64, 2048), gemm_tn_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tt_square_float",
+                     benchmark_sizes(64, 2048), gemm_tt_square_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tt_square_double",
+                     benchmark_sizes(64, 2048), gemm_tt_square_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tn_packed_float",
+                     benchmark_sizes(64, 2048), gemm_tn_packed_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tn_packed_double",
+                     benchmark_sizes(64, 2048), gemm_tn_packed_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_quantized_square_float",
+                     benchmark_sizes(64, 2048), gemm_quantized_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nn_tallskinny_float",
+                     benchmark_sizes(1024, 1 << 20),
+                     gemm_nn_tallskinny_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nn_tallskinny_double",
+                     benchmark_sizes(1024, 1 << 20),
+                     gemm_nn_tallskinny_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nn_batched_float",
+                     benchmark_sizes(1, 256), gemm_nn_batched_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_nn_batched_double",
+                     benchmark_sizes(1, 256), gemm_nn_batched_bench<double>);
 
-BENCHMARK_REGISTER_FUNCTION("iamax_double", iamax_bench<double>);
+// every configuration _gemm can dispatch to, see TO_TPARAMS
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_4x4_16x16_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 4, 4, 16, 16>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_4x4_16x16_double",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<double, 128, false, 4, 4, 16, 16>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_2x2_8x8_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 2, 2, 8, 8>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_2x2_8x8_double",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<double, 128, false, 2, 2, 8, 8>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_8x8_8x8_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 8, 8, 8, 8>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_8x8_8x8_double",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<double, 128, false, 8, 8, 8, 8>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_db_1x1_16x16_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, true, 1, 1, 16, 16>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_db_1x1_16x16_double",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<double, 128, true, 1, 1, 16, 16>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_8x8_16x16_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 8, 8, 16, 16>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_tile_128_8x8_16x16_double",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<double, 128, false, 8, 8, 16, 16>);
 
-BENCHMARK_REGISTER_FUNCTION("scal2op_float", scal2op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal2op_double", scal2op_bench<double>);
+  // the same tiles with the global loads pipelined behind the arithmetic
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_pipe_4x4_16x16_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 4, 4, 16, 16, true>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_pipe_2x2_8x8_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 2, 2, 8, 8, true>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_pipe_8x8_8x8_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 8, 8, 8, 8, true>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_pipe_db_1x1_16x16_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, true, 1, 1, 16, 16, true>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_pipe_8x8_16x16_float",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<float, 128, false, 8, 8, 16, 16, true>);
+  BENCHMARK_REGISTER(registry, blasbenchmark,
+                     "gemm_tile_128_pipe_8x8_16x16_double",
+                     benchmark_sizes(64, 2048),
+                     gemm_tile_bench<double, 128, false, 8, 8, 16, 16, true>);
 
-BENCHMARK_REGISTER_FUNCTION("scal3op_float", scal3op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("scal3op_double", scal3op_bench<double>);
+  // the default tiles of _gemm with scalar and vector global accesses
+  BENCHMARK_REGISTER(
+      registry, blasbenchmark, "gemm_tile_128_vec4_8x8_8x8_float",
+      benchmark_sizes(64, 2048),
+      gemm_tile_bench<float, 128, false, 8, 8, 8, 8, false, 4>);
+  BENCHMARK_REGISTER(
+      registry, blasbenchmark, "gemm_tile_128_vec4_8x8_16x16_float",
+      benchmark_sizes(64, 2048),
+      gemm_tile_bench<float, 128, false, 8, 8, 16, 16, false, 4>);
+  BENCHMARK_REGISTER(
+      registry, blasbenchmark, "gemm_tile_128_vec4_8x8_16x16_double",
+      benchmark_sizes(64, 2048),
+      gemm_tile_bench<double, 128, false, 8, 8, 16, 16, false, 4>);
+  BENCHMARK_REGISTER(
+      registry, blasbenchmark, "gemm_tile_128_vec2_8x8_16x16_double",
+      benchmark_sizes(64, 2048),
+      gemm_tile_bench<double, 128, false, 8, 8, 16, 16, false, 2>);
 
-BENCHMARK_REGISTER_FUNCTION("axpy3op_float", axpy3op_bench<float>);
-BENCHMARK_REGISTER_FUNCTION("axpy3op_double", axpy3op_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_raster_column_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_raster_bench<float, ColumnRaster>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_raster_grouped4_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_raster_bench<float, GroupedRaster<4>>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_raster_grouped8_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_raster_bench<float, GroupedRaster<8>>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_raster_morton_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_raster_bench<float, MortonRaster>);
 
-BENCHMARK_REGISTER_FUNCTION("blas1_double", blas1_bench<double>);
+  // Strassen-Winograd against _gemm, for the _gemm_strassen cutoff
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_strassen_0_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_strassen_bench<float, 0>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_strassen_1_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_strassen_bench<float, 1>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_strassen_2_float",
+                     benchmark_sizes(1024, 8192),
+                     gemm_strassen_bench<float, 2>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_strassen_0_double",
+                     benchmark_sizes(1024, 8192),
+                     gemm_strassen_bench<double, 0>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_strassen_1_double",
+                     benchmark_sizes(1024, 8192),
+                     gemm_strassen_bench<double, 1>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_strassen_2_double",
+                     benchmark_sizes(1024, 8192),
+                     gemm_strassen_bench<double, 2>);
 
-BENCHMARK_MAIN_END();
+  return registry.run(args);
+}
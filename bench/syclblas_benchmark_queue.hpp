@@ -0,0 +1,82 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syclblas_benchmark_queue.hpp
+ *
+ **************************************************************************/
+
+#ifndef SYCLBLAS_BENCHMARK_QUEUE_HPP
+#define SYCLBLAS_BENCHMARK_QUEUE_HPP
+
+#include <string>
+
+#include <CL/sycl.hpp>
+
+#include "blas_benchmark.hpp"
+
+/*! benchmark_exception_handler.
+ * Prints the asynchronous errors of the benchmark queues.
+ */
+inline void benchmark_exception_handler(cl::sycl::exception_list eL) {
+  for (auto &e : eL) {
+    try {
+      std::rethrow_exception(e);
+    } catch (cl::sycl::exception &e) {
+      std::cout << " E " << e.what() << std::endl;
+    } catch (...) {
+      std::cout << " An exception " << std::endl;
+    }
+  }
+}
+
+inline cl::sycl::queue select_benchmark_queue(const std::string &device) {
+  if (device == "cpu") {
+    return cl::sycl::queue(cl::sycl::cpu_selector(),
+                           benchmark_exception_handler);
+  } else if (device == "gpu") {
+    return cl::sycl::queue(cl::sycl::gpu_selector(),
+                           benchmark_exception_handler);
+  } else if (device == "host") {
+    return cl::sycl::queue(cl::sycl::host_selector(),
+                           benchmark_exception_handler);
+  }
+  return cl::sycl::queue(cl::sycl::default_selector(),
+                         benchmark_exception_handler);
+}
+
+/*! make_benchmark_queue.
+ * Creates the queue of a SYCL-BLAS benchmark on the device given by
+ * --device (default, cpu, gpu or host) and records the device in the
+ * context of the results.
+ */
+inline cl::sycl::queue make_benchmark_queue(const std::string &device) {
+  auto q = select_benchmark_queue(device);
+  auto dev = q.get_device();
+  auto &output = benchmark_output::get();
+  output.set_context("library", "sycl-blas");
+  output.set_context("device", dev.get_info<cl::sycl::info::device::name>());
+  output.set_context("vendor", dev.get_info<cl::sycl::info::device::vendor>());
+  output.set_context("driver",
+                     dev.get_info<cl::sycl::info::device::driver_version>());
+  return q;
+}
+
+#endif  // SYCLBLAS_BENCHMARK_QUEUE_HPP
@@ -0,0 +1,311 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syclblas_overhead_benchmark.cpp
+ *
+ **************************************************************************/
+
+#include "blas_benchmark.hpp"
+#include "syclblas_benchmark_queue.hpp"
+
+#include <interface/blas1_interface_sycl.hpp>
+#include <interface/blas3_interface_sycl.hpp>
+
+using namespace blas;
+
+/*! empty_kernel.
+ * Does nothing, so launching it measures the cost of the runtime alone.
+ */
+struct empty_kernel {
+  void operator()(cl::sycl::nd_item<1>) const {}
+};
+
+/*! SyclBlasOverheadBenchmarker.
+ * Splits the host-side cost of a SYCL-BLAS call into its phases: pointer
+ * lookups in the pointer mapper, view and expression tree construction,
+ * make_accessor, command group submission and the launch itself. The host
+ * phases are cheap, so each sample times calls_per_sample calls of them.
+ */
+template <typename ExecutorType = SYCL>
+class SyclBlasOverheadBenchmarker {
+  cl::sycl::queue q;
+  Executor<ExecutorType> ex;
+
+  using ScalarT = float;
+  using ContainerT =
+      typename Executor<ExecutorType>::template ContainerT<ScalarT>;
+  using VectorView = vector_view<ScalarT, ContainerT>;
+  using MatrixView = matrix_view<ScalarT, ContainerT>;
+
+  static constexpr size_t calls_per_sample = 100;
+
+  /*! live_allocations.
+   * Allocates `count` buffers so that the lookups are measured with a
+   * populated pointer mapper.
+   */
+  std::vector<ScalarT *> live_allocations(size_t count) {
+    std::vector<ScalarT *> ptrs;
+    for (size_t i = 0; i < count; i++) {
+      ptrs.push_back(ex.template allocate<ScalarT>(16));
+    }
+    return ptrs;
+  }
+
+  void release_allocations(std::vector<ScalarT *> &ptrs) {
+    for (auto ptr : ptrs) ex.template deallocate<ScalarT>(ptr);
+  }
+
+ public:
+  explicit SyclBlasOverheadBenchmarker(const std::string &device)
+      : q(make_benchmark_queue(device)), ex(q) {}
+
+  /*! get_buffer_bench.
+   * Executor::get_buffer on the middle of `size` live allocations.
+   */
+  BENCHMARK_FUNCTION(get_buffer_bench) {
+    auto ptrs = live_allocations(size);
+    auto ptr = ptrs[size / 2];
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      for (size_t i = 0; i < calls_per_sample; i++) {
+        auto buffer = ex.get_buffer(ptr);
+        (void)buffer;
+      }
+    });
+    release_allocations(ptrs);
+    result.shape = "allocations=" + std::to_string(size) +
+                   ",calls=" + std::to_string(calls_per_sample);
+    return result;
+  }
+
+  /*! get_offset_bench.
+   * Executor::get_offset on the middle of `size` live allocations.
+   */
+  BENCHMARK_FUNCTION(get_offset_bench) {
+    auto ptrs = live_allocations(size);
+    auto ptr = ptrs[size / 2];
+    volatile ptrdiff_t offset = 0;
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      for (size_t i = 0; i < calls_per_sample; i++) {
+        offset = ex.get_offset(ptr);
+      }
+    });
+    release_allocations(ptrs);
+    result.shape = "allocations=" + std::to_string(size) +
+                   ",calls=" + std::to_string(calls_per_sample);
+    return result;
+  }
+
+  /*! view_bench.
+   * Building the views and the expression tree of _axpy from buffers that
+   * have already been looked up.
+   */
+  BENCHMARK_FUNCTION(view_bench) {
+    auto vx = ex.template allocate<ScalarT>(size);
+    auto vy = ex.template allocate<ScalarT>(size);
+    auto x_container = ex.get_buffer(vx);
+    auto y_container = ex.get_buffer(vy);
+    volatile size_t tree_size = 0;
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      for (size_t i = 0; i < calls_per_sample; i++) {
+        VectorView x{x_container, 0, 1, size};
+        VectorView y{y_container, 0, 1, size};
+        auto scalOp = make_op<ScalarOp, prdOp2_struct>(ScalarT(2), x);
+        auto addOp = make_op<BinaryOp, addOp2_struct>(y, scalOp);
+        auto assignOp = make_op<Assign>(y, addOp);
+        tree_size += assignOp.getSize();
+      }
+    });
+    ex.template deallocate<ScalarT>(vx);
+    ex.template deallocate<ScalarT>(vy);
+    result.shape = "n=" + std::to_string(size) +
+                   ",calls=" + std::to_string(calls_per_sample);
+    return result;
+  }
+
+  /*! make_accessor_bench.
+   * Conversion of the _axpy tree into its accessor form, timed inside the
+   * command group; the command group launches an empty kernel so that the
+   * accessors are actually required.
+   */
+  BENCHMARK_FUNCTION(make_accessor_bench) {
+    auto vx = ex.template allocate<ScalarT>(size);
+    auto vy = ex.template allocate<ScalarT>(size);
+    auto x_container = ex.get_buffer(vx);
+    auto y_container = ex.get_buffer(vy);
+    VectorView x{x_container, 0, 1, size};
+    VectorView y{y_container, 0, 1, size};
+    auto scalOp = make_op<ScalarOp, prdOp2_struct>(ScalarT(2), x);
+    auto addOp = make_op<BinaryOp, addOp2_struct>(y, scalOp);
+    auto assignOp = make_op<Assign>(y, addOp);
+    std::vector<double> phase;
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      ex.sycl_queue().submit([&](cl::sycl::handler &h) {
+        auto start = std::chrono::steady_clock::now();
+        auto tree = blas::make_accessor(assignOp, h);
+        auto end = std::chrono::steady_clock::now();
+        (void)tree;
+        phase.push_back(
+            std::chrono::duration<double, std::nano>(end - start).count());
+        h.parallel_for(cl::sycl::nd_range<1>(cl::sycl::range<1>(1),
+                                             cl::sycl::range<1>(1)),
+                       empty_kernel());
+      });
+      ex.sycl_queue().wait_and_throw();
+    });
+    ex.template deallocate<ScalarT>(vx);
+    ex.template deallocate<ScalarT>(vy);
+    result = replace_samples(result, phase);
+    result.shape = "n=" + std::to_string(size);
+    return result;
+  }
+
+  /*! get_nd_range_bench.
+   * GemmFactory::get_nd_range, computed on the host for every GEMM launch.
+   */
+  BENCHMARK_FUNCTION(get_nd_range_bench) {
+    using GemmT = GemmFactory<MatrixView, MatrixView, false, false, false, 64,
+                              Tile<>, false, false, ScalarT>;
+    volatile size_t global_size = 0;
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      for (size_t i = 0; i < calls_per_sample; i++) {
+        global_size += GemmT::get_nd_range(size, size).get_global()[0];
+      }
+    });
+    result.shape = "m=" + std::to_string(size) + ",n=" + std::to_string(size) +
+                   ",calls=" + std::to_string(calls_per_sample);
+    return result;
+  }
+
+  /*! submit_empty_bench.
+   * Submission only of an empty kernel over `size` work items; the wait is
+   * outside the timed region.
+   */
+  BENCHMARK_FUNCTION(submit_empty_bench) {
+    const size_t local = std::min<size_t>(size, 128);
+    const size_t global = (size + local - 1) / local * local;
+    std::vector<double> phase;
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      auto start = std::chrono::steady_clock::now();
+      ex.sycl_queue().submit([&](cl::sycl::handler &h) {
+        h.parallel_for(cl::sycl::nd_range<1>(cl::sycl::range<1>(global),
+                                             cl::sycl::range<1>(local)),
+                       empty_kernel());
+      });
+      auto end = std::chrono::steady_clock::now();
+      phase.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+      ex.sycl_queue().wait_and_throw();
+    });
+    return replace_samples(result, phase);
+  }
+
+  /*! submit_axpy_bench.
+   * Submission only of _axpy, i.e. the pointer lookups, the tree
+   * construction, make_accessor and the submission, without the kernel.
+   */
+  BENCHMARK_FUNCTION(submit_axpy_bench) {
+    ScalarT *v1 = new_data<ScalarT>(size);
+    auto vx = ex.template allocate<ScalarT>(size);
+    auto vy = ex.template allocate<ScalarT>(size);
+    ex.copy_to_device(v1, vx, size);
+    ex.copy_to_device(v1, vy, size);
+    std::vector<double> phase;
+    auto result = benchmark<>::measure(no_reps, 0, 0, [&]() {
+      auto start = std::chrono::steady_clock::now();
+      _axpy(ex, size, ScalarT(2), vx, 1, vy, 1);
+      auto end = std::chrono::steady_clock::now();
+      phase.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+      ex.sycl_queue().wait_and_throw();
+    });
+    ex.template deallocate<ScalarT>(vx);
+    ex.template deallocate<ScalarT>(vy);
+    release_data(v1);
+    return replace_samples(result, phase);
+  }
+
+  /*! empty_kernel_bench.
+   * Submission and completion of an empty kernel over `size` work items.
+   */
+  BENCHMARK_FUNCTION(empty_kernel_bench) {
+    const size_t local = std::min<size_t>(size, 128);
+    const size_t global = (size + local - 1) / local * local;
+    return benchmark<>::measure(no_reps, 0, 0, [&]() {
+      ex.sycl_queue().submit([&](cl::sycl::handler &h) {
+        h.parallel_for(cl::sycl::nd_range<1>(cl::sycl::range<1>(global),
+                                             cl::sycl::range<1>(local)),
+                       empty_kernel());
+      });
+      ex.sycl_queue().wait_and_throw();
+    });
+  }
+
+  /*! axpy_bench.
+   * Submission and completion of _axpy; at size 1 the difference with
+   * empty_kernel_bench is the cost SYCL-BLAS adds to a launch.
+   */
+  BENCHMARK_FUNCTION(axpy_bench) {
+    ScalarT *v1 = new_data<ScalarT>(size);
+    auto vx = ex.template allocate<ScalarT>(size);
+    auto vy = ex.template allocate<ScalarT>(size);
+    ex.copy_to_device(v1, vx, size);
+    ex.copy_to_device(v1, vy, size);
+    const size_t bytes = size * 3 * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, size * 2, bytes, [&]() {
+      _axpy(ex, size, ScalarT(2), vx, 1, vy, 1);
+      ex.sycl_queue().wait_and_throw();
+    });
+    ex.template deallocate<ScalarT>(vx);
+    ex.template deallocate<ScalarT>(vy);
+    release_data(v1);
+    return result;
+  }
+};
+
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<SyclBlasOverheadBenchmarker<SYCL>> blasbenchmark(
+      [&]() { return new SyclBlasOverheadBenchmarker<SYCL>(args.device); });
+  benchmark_registry registry;
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "get_buffer_float",
+                     benchmark_sizes(1, 4096, 4), get_buffer_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "get_offset_float",
+                     benchmark_sizes(1, 4096, 4), get_offset_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "view_float",
+                     benchmark_sizes(1, 1, 4), view_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "make_accessor_float",
+                     benchmark_sizes(1, 1, 4), make_accessor_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "get_nd_range_float",
+                     benchmark_sizes(1024, 1024, 4), get_nd_range_bench<float>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "submit_empty_float",
+                     benchmark_sizes(1, 65536, 4), submit_empty_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "submit_axpy_float",
+                     benchmark_sizes(1, 65536, 4), submit_axpy_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "empty_kernel_float",
+                     benchmark_sizes(1, 65536, 4), empty_kernel_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_float",
+                     benchmark_sizes(1, 65536, 4), axpy_bench<float>);
+
+  return registry.run(args);
+}
@@ -0,0 +1,374 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syclblas_reference_benchmark.cpp
+ *
+ **************************************************************************/
+
+#include "blas_benchmark.hpp"
+#include "syclblas_benchmark_queue.hpp"
+
+#include <cstdlib>
+
+#include <interface/blas1_interface_sycl.hpp>
+#include <interface/blas2_interface_sycl.hpp>
+#include <interface/blas3_interface_sycl.hpp>
+
+#include "system_reference_blas.hpp"
+
+using namespace blas;
+
+/*! SyclBlasReferenceBenchmarker.
+ * Runs every routine through SYCL-BLAS on a CPU device and through the
+ * system reference BLAS on the host, from the same input data. The
+ * SYCL-BLAS timings are reported, with the reference median and the speedup
+ * over it as counters.
+ */
+template <typename ExecutorType = SYCL>
+class SyclBlasReferenceBenchmarker {
+  cl::sycl::queue q;
+  Executor<ExecutorType> ex;
+
+  /*! device_data.
+   * A device copy of a host vector, released with the benchmark.
+   */
+  template <typename T>
+  struct device_data {
+    Executor<ExecutorType> &ex;
+    T *ptr;
+
+    device_data(Executor<ExecutorType> &ex_, std::vector<T> &host)
+        : ex(ex_), ptr(ex_.template allocate<T>(host.size())) {
+      ex.copy_to_device(host.data(), ptr, host.size());
+    }
+    ~device_data() { ex.template deallocate<T>(ptr); }
+  };
+
+  template <typename T>
+  static std::vector<T> host_data(size_t size) {
+    T *data = new_data<T>(size);
+    std::vector<T> v(data, data + size);
+    release_data(data);
+    return v;
+  }
+
+  /*! compare.
+   * Measures the SYCL-BLAS and the reference implementation of a routine.
+   * Both functions must block until the routine has completed.
+   */
+  template <typename SyclF, typename RefF>
+  static benchmark_result compare(size_t no_reps, size_t flops, size_t bytes,
+                                  SyclF sycl_func, RefF ref_func) {
+    auto result = benchmark<>::measure(no_reps, flops, bytes, sycl_func);
+    auto reference = benchmark<>::measure(no_reps, flops, bytes, ref_func);
+    result.counters.emplace_back("reference_p50_ns", reference.stats.p50);
+    result.counters.emplace_back("speedup",
+                                 reference.stats.p50 / result.stats.p50);
+    return result;
+  }
+
+ public:
+  // the reference runs on the host, so by default so does SYCL-BLAS
+  explicit SyclBlasReferenceBenchmarker(const std::string &device)
+      : q(make_benchmark_queue(device == "default" ? "cpu" : device)), ex(q) {
+    auto &output = benchmark_output::get();
+    output.set_context("reference", "system BLAS");
+    // the reference library picks its thread count from the environment
+    for (auto var : {"OPENBLAS_NUM_THREADS", "OMP_NUM_THREADS"}) {
+      if (std::getenv(var)) {
+        output.set_context("reference_threads", std::getenv(var));
+        break;
+      }
+    }
+  }
+
+  BENCHMARK_FUNCTION(scal_bench) {
+    using ScalarT = TypeParam;
+    ScalarT alpha(1.0001);
+    auto v1 = host_data<ScalarT>(size);
+    device_data<ScalarT> inx(ex, v1);
+    return compare(no_reps, size, size * 2 * sizeof(ScalarT),
+                   [&]() {
+                     _scal(ex, size, alpha, inx.ptr, 1);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { scal(size, alpha, v1.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(axpy_bench) {
+    using ScalarT = TypeParam;
+    ScalarT alpha(1.0001);
+    auto v1 = host_data<ScalarT>(size);
+    auto v2 = host_data<ScalarT>(size);
+    device_data<ScalarT> inx(ex, v1), iny(ex, v2);
+    return compare(no_reps, size * 2, size * 3 * sizeof(ScalarT),
+                   [&]() {
+                     _axpy(ex, size, alpha, inx.ptr, 1, iny.ptr, 1);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { axpy(size, alpha, v1.data(), 1, v2.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(copy_bench) {
+    using ScalarT = TypeParam;
+    auto v1 = host_data<ScalarT>(size);
+    auto v2 = host_data<ScalarT>(size);
+    device_data<ScalarT> inx(ex, v1), iny(ex, v2);
+    return compare(no_reps, 0, size * 2 * sizeof(ScalarT),
+                   [&]() {
+                     _copy(ex, size, inx.ptr, 1, iny.ptr, 1);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { copy(size, v1.data(), 1, v2.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(swap_bench) {
+    using ScalarT = TypeParam;
+    auto v1 = host_data<ScalarT>(size);
+    auto v2 = host_data<ScalarT>(size);
+    device_data<ScalarT> inx(ex, v1), iny(ex, v2);
+    return compare(no_reps, 0, size * 4 * sizeof(ScalarT),
+                   [&]() {
+                     _swap(ex, size, inx.ptr, 1, iny.ptr, 1);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { swap(size, v1.data(), 1, v2.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(rot_bench) {
+    using ScalarT = TypeParam;
+    ScalarT c(0.6), s(0.8);
+    auto v1 = host_data<ScalarT>(size);
+    auto v2 = host_data<ScalarT>(size);
+    device_data<ScalarT> inx(ex, v1), iny(ex, v2);
+    return compare(no_reps, size * 6, size * 4 * sizeof(ScalarT),
+                   [&]() {
+                     _rot(ex, size, inx.ptr, 1, iny.ptr, 1, c, s);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { rot(size, v1.data(), 1, v2.data(), 1, c, s); });
+  }
+
+  BENCHMARK_FUNCTION(asum_bench) {
+    using ScalarT = TypeParam;
+    auto v1 = host_data<ScalarT>(size);
+    std::vector<ScalarT> vr(1);
+    device_data<ScalarT> inx(ex, v1), inr(ex, vr);
+    volatile ScalarT res;
+    return compare(no_reps, size * 2, size * sizeof(ScalarT),
+                   [&]() {
+                     _asum(ex, size, inx.ptr, 1, inr.ptr);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { res = asum(size, v1.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(dot_bench) {
+    using ScalarT = TypeParam;
+    auto v1 = host_data<ScalarT>(size);
+    auto v2 = host_data<ScalarT>(size);
+    std::vector<ScalarT> vr(1);
+    device_data<ScalarT> inx(ex, v1), iny(ex, v2), inr(ex, vr);
+    volatile ScalarT res;
+    return compare(no_reps, size * 2, size * 2 * sizeof(ScalarT),
+                   [&]() {
+                     _dot(ex, size, inx.ptr, 1, iny.ptr, 1, inr.ptr);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { res = dot(size, v1.data(), 1, v2.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(nrm2_bench) {
+    using ScalarT = TypeParam;
+    auto v1 = host_data<ScalarT>(size);
+    std::vector<ScalarT> vr(1);
+    device_data<ScalarT> inx(ex, v1), inr(ex, vr);
+    volatile ScalarT res;
+    return compare(no_reps, size * 2, size * sizeof(ScalarT),
+                   [&]() {
+                     _nrm2(ex, size, inx.ptr, 1, inr.ptr);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { res = nrm2(size, v1.data(), 1); });
+  }
+
+  BENCHMARK_FUNCTION(iamax_bench) {
+    using ScalarT = TypeParam;
+    auto v1 = host_data<ScalarT>(size);
+    std::vector<IndexValueTuple<ScalarT>> vr(1, IndexValueTuple<ScalarT>(0, 0));
+    device_data<ScalarT> inx(ex, v1);
+    device_data<IndexValueTuple<ScalarT>> outI(ex, vr);
+    volatile int res;
+    return compare(no_reps, size * 2, size * sizeof(ScalarT),
+                   [&]() {
+                     _iamax(ex, size, inx.ptr, 1, outI.ptr);
+                     ex.sycl_queue().wait_and_throw();
+                   },
+                   [&]() { res = iamax(size, v1.data(), 1); });
+  }
+
+  template <typename ScalarT>
+  benchmark_result gemv_bench_impl(size_t no_reps, char trans, size_t m,
+                                   size_t n) {
+    ScalarT alpha(1.5), beta(0.5);
+    const size_t len_x = (trans == 'n') ? n : m;
+    const size_t len_y = (trans == 'n') ? m : n;
+    auto a = host_data<ScalarT>(m * n);
+    auto x = host_data<ScalarT>(len_x);
+    auto y = host_data<ScalarT>(len_y);
+    device_data<ScalarT> ina(ex, a), inx(ex, x), iny(ex, y);
+    const char trans_str[] = {trans, '\0'};
+    const size_t bytes = (m * n + len_x + 2 * len_y) * sizeof(ScalarT);
+    auto result = compare(
+        no_reps, 2 * m * n, bytes,
+        [&]() {
+          _gemv(ex, trans, m, n, alpha, ina.ptr, m, inx.ptr, 1, beta, iny.ptr,
+                1);
+          ex.sycl_queue().wait_and_throw();
+        },
+        [&]() {
+          gemv(trans_str, m, n, alpha, a.data(), m, x.data(), 1, beta,
+               y.data(), 1);
+        });
+    result.shape = std::string("trans=") + trans + ",m=" + std::to_string(m) +
+                   ",n=" + std::to_string(n);
+    return result;
+  }
+
+  BENCHMARK_FUNCTION(gemv_n_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 'n', size, size);
+  }
+
+  BENCHMARK_FUNCTION(gemv_t_bench) {
+    return gemv_bench_impl<TypeParam>(no_reps, 't', size, size);
+  }
+
+  BENCHMARK_FUNCTION(ger_bench) {
+    using ScalarT = TypeParam;
+    ScalarT alpha(1.5);
+    auto a = host_data<ScalarT>(size * size);
+    auto x = host_data<ScalarT>(size);
+    auto y = host_data<ScalarT>(size);
+    device_data<ScalarT> ina(ex, a), inx(ex, x), iny(ex, y);
+    const size_t bytes = (2 * size * size + 2 * size) * sizeof(ScalarT);
+    auto result = compare(
+        no_reps, 2 * size * size, bytes,
+        [&]() {
+          _ger(ex, size, size, alpha, inx.ptr, 1, iny.ptr, 1, ina.ptr, size);
+          ex.sycl_queue().wait_and_throw();
+        },
+        [&]() {
+          ger(size, size, alpha, x.data(), 1, y.data(), 1, a.data(), size);
+        });
+    result.shape = "m=" + std::to_string(size) + ",n=" + std::to_string(size);
+    return result;
+  }
+
+  BENCHMARK_FUNCTION(gemm_bench) {
+    using ScalarT = TypeParam;
+    ScalarT alpha(1.5), beta(0.5);
+    auto a = host_data<ScalarT>(size * size);
+    auto b = host_data<ScalarT>(size * size);
+    auto c = host_data<ScalarT>(size * size);
+    device_data<ScalarT> ina(ex, a), inb(ex, b), inc(ex, c);
+    const size_t bytes = 4 * size * size * sizeof(ScalarT);
+    auto result = compare(
+        no_reps, 2 * size * size * size, bytes,
+        [&]() {
+          _gemm(ex, 'n', 'n', size, size, size, alpha, ina.ptr, size, inb.ptr,
+                size, beta, inc.ptr, size);
+          ex.sycl_queue().wait_and_throw();
+        },
+        [&]() {
+          gemm("n", "n", size, size, size, alpha, a.data(), size, b.data(),
+               size, beta, c.data(), size);
+        });
+    result.shape = "trans=nn,m=" + std::to_string(size) +
+                   ",n=" + std::to_string(size) +
+                   ",k=" + std::to_string(size);
+    return result;
+  }
+};
+
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<SyclBlasReferenceBenchmarker<SYCL>> blasbenchmark(
+      [&]() { return new SyclBlasReferenceBenchmarker<SYCL>(args.device); });
+  benchmark_registry registry;
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), scal_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "scal_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), scal_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), axpy_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "axpy_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), axpy_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), copy_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "copy_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), copy_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "swap_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), swap_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "swap_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), swap_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "rot_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), rot_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "rot_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), rot_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "asum_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), asum_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "asum_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), asum_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "dot_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), dot_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "dot_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), dot_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), nrm2_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "nrm2_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), nrm2_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "iamax_float",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), iamax_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "iamax_double",
+                     benchmark_sizes(1 << 10, 1 << 24, 4), iamax_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_float",
+                     benchmark_sizes(64, 4096, 4), gemv_n_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_n_double",
+                     benchmark_sizes(64, 4096, 4), gemv_n_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_float",
+                     benchmark_sizes(64, 4096, 4), gemv_t_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemv_t_double",
+                     benchmark_sizes(64, 4096, 4), gemv_t_bench<double>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_float",
+                     benchmark_sizes(64, 4096, 4), ger_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "ger_double",
+                     benchmark_sizes(64, 4096, 4), ger_bench<double>);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_float",
+                     benchmark_sizes(64, 1024, 4), gemm_bench<float>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_double",
+                     benchmark_sizes(64, 1024, 4), gemm_bench<double>);
+
+  return registry.run(args);
+}
@@ -0,0 +1,302 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syclblas_scaling_benchmark.cpp
+ *
+ **************************************************************************/
+
+#include "blas_benchmark.hpp"
+#include "syclblas_benchmark_queue.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+#include <interface/blas1_interface_sycl.hpp>
+#include <interface/blas3_interface_sycl.hpp>
+
+using namespace blas;
+
+/*! worker_pool.
+ * A fixed set of host threads that run the same function, each with its own
+ * index, and return once all of them have finished. Threads are created
+ * once so that their start-up cost stays out of the measurements.
+ */
+class worker_pool {
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::condition_variable start_cv, done_cv;
+  std::function<void(size_t)> task;
+  size_t generation = 0;
+  size_t running = 0;
+  bool stopping = false;
+
+  void worker(size_t id) {
+    size_t seen = 0;
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex);
+      start_cv.wait(lock, [&] { return stopping || generation != seen; });
+      if (stopping) return;
+      seen = generation;
+      lock.unlock();
+      task(id);
+      lock.lock();
+      if (--running == 0) done_cv.notify_one();
+    }
+  }
+
+ public:
+  explicit worker_pool(size_t num_threads) {
+    for (size_t i = 0; i < num_threads; i++) {
+      threads.emplace_back(&worker_pool::worker, this, i);
+    }
+  }
+
+  ~worker_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    start_cv.notify_all();
+    for (auto &t : threads) t.join();
+  }
+
+  size_t size() const { return threads.size(); }
+
+  void run(std::function<void(size_t)> f) {
+    std::unique_lock<std::mutex> lock(mutex);
+    task = f;
+    running = threads.size();
+    generation++;
+    start_cv.notify_all();
+    done_cv.wait(lock, [&] { return running == 0; });
+  }
+};
+
+/*! SyclBlasScalingBenchmarker.
+ * Runs _axpy from several host threads at once, either all sharing one
+ * executor (and so one queue and one pointer mapper) or each with its own
+ * executor on its own queue for the same device. In weak scaling every
+ * thread works on `size` elements, in strong scaling the `size` elements
+ * are split between the threads. Each sample is one call per thread; the
+ * latency of the individual calls and the efficiency against a single
+ * thread with the same setup are reported as counters.
+ *
+ * It also runs _gemm_multi with the columns of C split between executors on
+ * as many queues of the same device, balanced by their measured throughput.
+ */
+template <typename ExecutorType = SYCL>
+class SyclBlasScalingBenchmarker {
+  cl::sycl::queue q;
+  Executor<ExecutorType> ex;
+  // single thread throughput, keyed by (size, shared executor, weak scaling)
+  std::map<std::tuple<size_t, bool, bool>, double> baseline;
+  // single queue throughput of _gemm_multi, keyed by size
+  std::map<size_t, double> gemm_baseline;
+
+ public:
+  explicit SyclBlasScalingBenchmarker(const std::string &device)
+      : q(make_benchmark_queue(device)), ex(q) {
+    auto &output = benchmark_output::get();
+    output.set_context("hardware_threads",
+                       std::to_string(std::thread::hardware_concurrency()));
+  }
+
+  /*! scaling_bench.
+   * Must be registered with Threads == 1 before the larger thread counts of
+   * the same setup, which use it as the baseline of their efficiency.
+   */
+  template <class TypeParam, int Threads, bool SharedExecutor, bool Weak>
+  benchmark_result scaling_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    const size_t n = Weak ? size : (size + Threads - 1) / Threads;
+    ScalarT *v1 = new_data<ScalarT>(n);
+    ScalarT alpha(2.4367453465);
+
+    std::vector<cl::sycl::queue> queues;
+    std::vector<std::unique_ptr<Executor<ExecutorType>>> executors;
+    if (!SharedExecutor) {
+      for (int t = 0; t < Threads; t++) {
+        queues.emplace_back(q.get_context(), q.get_device());
+        executors.emplace_back(new Executor<ExecutorType>(queues.back()));
+      }
+    }
+    auto executor = [&](size_t t) -> Executor<ExecutorType> & {
+      return SharedExecutor ? ex : *executors[t];
+    };
+
+    std::vector<ScalarT *> inx(Threads), iny(Threads);
+    for (int t = 0; t < Threads; t++) {
+      inx[t] = executor(t).template allocate<ScalarT>(n);
+      iny[t] = executor(t).template allocate<ScalarT>(n);
+      executor(t).copy_to_device(v1, inx[t], n);
+      executor(t).copy_to_device(v1, iny[t], n);
+    }
+
+    worker_pool pool(Threads);
+    std::mutex latency_mutex;
+    std::vector<double> latencies;
+    const size_t bytes = n * Threads * 3 * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, n * Threads * 2, bytes, [&]() {
+      pool.run([&](size_t t) {
+        auto &ex_t = executor(t);
+        auto start = std::chrono::steady_clock::now();
+        auto event = _axpy(ex_t, n, alpha, inx[t], 1, iny[t], 1);
+        event.wait_and_throw();
+        auto end = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(latency_mutex);
+        latencies.push_back(
+            std::chrono::duration<double, std::nano>(end - start).count());
+      });
+    });
+
+    for (int t = 0; t < Threads; t++) {
+      executor(t).template deallocate<ScalarT>(inx[t]);
+      executor(t).template deallocate<ScalarT>(iny[t]);
+    }
+    release_data(v1);
+
+    // the warm-up calls are the first ones recorded
+    latencies.erase(latencies.begin(),
+                    latencies.end() - result.samples.size() * Threads);
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto key = std::make_tuple(size, SharedExecutor, Weak);
+    if (Threads == 1) baseline[key] = result.flops_per_second();
+    const double efficiency =
+        (baseline.count(key) && baseline[key] > 0)
+            ? result.flops_per_second() / (Threads * baseline[key])
+            : 0;
+
+    result.shape = "n=" + std::to_string(n) +
+                   ",threads=" + std::to_string(Threads) + ",executor=" +
+                   (SharedExecutor ? "shared" : "per_thread") +
+                   ",scaling=" + (Weak ? "weak" : "strong");
+    result.counters.emplace_back("efficiency", efficiency);
+    result.counters.emplace_back("latency_p50_ns", percentile(latencies, 50));
+    result.counters.emplace_back("latency_p95_ns", percentile(latencies, 95));
+    result.counters.emplace_back("latency_p99_ns", percentile(latencies, 99));
+    return result;
+  }
+
+  /*! gemm_multi_bench.
+   * Square _gemm_multi on host matrices over Queues executors. Must be
+   * registered with Queues == 1 first, as the baseline of the efficiency.
+   */
+  template <class TypeParam, int Queues>
+  benchmark_result gemm_multi_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    ScalarT *a = new_data<ScalarT>(size * size);
+    ScalarT *b = new_data<ScalarT>(size * size);
+    ScalarT *c = new_data<ScalarT>(size * size);
+    ScalarT alpha(1.5), beta(0.5);
+
+    std::vector<cl::sycl::queue> queues;
+    std::vector<std::unique_ptr<Executor<ExecutorType>>> executors;
+    std::vector<Executor<ExecutorType> *> executor_ptrs;
+    for (int i = 0; i < Queues; i++) {
+      queues.emplace_back(q.get_context(), q.get_device());
+      executors.emplace_back(new Executor<ExecutorType>(queues.back()));
+      executor_ptrs.push_back(executors.back().get());
+    }
+
+    // kept across the samples, so that the split converges
+    std::vector<double> throughput;
+    std::vector<double> latencies;
+    const size_t flops = 2 * size * size * size;
+    const size_t bytes = (Queues + 3) * size * size * sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      auto start = std::chrono::steady_clock::now();
+      _gemm_multi(executor_ptrs, 'n', 'n', size, size, size, alpha, a, size,
+                  b, size, beta, c, size, throughput);
+      auto end = std::chrono::steady_clock::now();
+      latencies.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+    });
+
+    release_data(a);
+    release_data(b);
+    release_data(c);
+
+    latencies.erase(latencies.begin(),
+                    latencies.end() - result.samples.size());
+    std::sort(latencies.begin(), latencies.end());
+
+    if (Queues == 1) gemm_baseline[size] = result.flops_per_second();
+    const double efficiency =
+        (gemm_baseline.count(size) && gemm_baseline[size] > 0)
+            ? result.flops_per_second() / (Queues * gemm_baseline[size])
+            : 0;
+
+    result.shape = "m=n=k=" + std::to_string(size) +
+                   ",queues=" + std::to_string(Queues);
+    result.counters.emplace_back("efficiency", efficiency);
+    result.counters.emplace_back("latency_p50_ns", percentile(latencies, 50));
+    result.counters.emplace_back("latency_p95_ns", percentile(latencies, 95));
+    result.counters.emplace_back("latency_p99_ns", percentile(latencies, 99));
+    return result;
+  }
+};
+
+#define REGISTER_SCALING(REGISTRY, OBJECT, NAME, SIZES, SHARED, WEAK) \
+  BENCHMARK_REGISTER(REGISTRY, OBJECT, NAME, SIZES,                   \
+                     scaling_bench<float, 1, SHARED, WEAK>);          \
+  BENCHMARK_REGISTER(REGISTRY, OBJECT, NAME, SIZES,                   \
+                     scaling_bench<float, 2, SHARED, WEAK>);          \
+  BENCHMARK_REGISTER(REGISTRY, OBJECT, NAME, SIZES,                   \
+                     scaling_bench<float, 4, SHARED, WEAK>);          \
+  BENCHMARK_REGISTER(REGISTRY, OBJECT, NAME, SIZES,                   \
+                     scaling_bench<float, 8, SHARED, WEAK>)
+
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<SyclBlasScalingBenchmarker<SYCL>> blasbenchmark(
+      [&]() { return new SyclBlasScalingBenchmarker<SYCL>(args.device); });
+  benchmark_registry registry;
+  const auto sizes = benchmark_sizes(1 << 10, 1 << 22, 4);
+
+  // the thread count is part of the shape, the baseline of the efficiency is
+  // the single thread run of the same setup, so it has to be registered first
+  REGISTER_SCALING(registry, blasbenchmark, "axpy_weak_shared_float", sizes,
+                   true, true);
+  REGISTER_SCALING(registry, blasbenchmark, "axpy_weak_per_thread_float",
+                   sizes, false, true);
+  REGISTER_SCALING(registry, blasbenchmark, "axpy_strong_shared_float", sizes,
+                   true, false);
+  REGISTER_SCALING(registry, blasbenchmark, "axpy_strong_per_thread_float",
+                   sizes, false, false);
+
+  // Queues == 1 first, it is the baseline of the efficiency
+  const auto gemm_sizes = benchmark_sizes(128, 2048);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_multi_float", gemm_sizes,
+                     gemm_multi_bench<float, 1>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_multi_float", gemm_sizes,
+                     gemm_multi_bench<float, 2>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_multi_float", gemm_sizes,
+                     gemm_multi_bench<float, 4>);
+
+  return registry.run(args);
+}
@@ -0,0 +1,161 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename syclblas_streaming_benchmark.cpp
+ *
+ **************************************************************************/
+
+#include "blas_benchmark.hpp"
+#include "syclblas_benchmark_queue.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <interface/blas3_interface_sycl.hpp>
+
+using namespace blas;
+
+/*! SyclBlasStreamingBenchmarker.
+ * Runs _gemm_streaming on square host matrices split in 4 x 4 blocks, with
+ * one to three sets of staging buffers. The same copies without any
+ * multiplication, and the same multiplications on resident buffers without
+ * any copy, are timed as well; the overlap counter is the part of the
+ * shorter of the two that the streaming run hid behind the other one (0
+ * when they ran back to back, 1 when the shorter one was entirely hidden).
+ */
+template <typename ExecutorType = SYCL>
+class SyclBlasStreamingBenchmarker {
+  cl::sycl::queue q;
+  Executor<ExecutorType> ex;
+
+  static constexpr size_t panels = 4;
+
+  /*! median_ns.
+   * Median of three timed calls of f, after an untimed one.
+   */
+  template <typename Function>
+  static double median_ns(Function f) {
+    f();
+    std::vector<double> times;
+    for (int i = 0; i < 3; i++) {
+      auto start = std::chrono::steady_clock::now();
+      f();
+      auto end = std::chrono::steady_clock::now();
+      times.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[1];
+  }
+
+ public:
+  explicit SyclBlasStreamingBenchmarker(const std::string &device)
+      : q(make_benchmark_queue(device)), ex(q) {}
+
+  template <class TypeParam, int Stages>
+  benchmark_result streaming_bench(size_t no_reps, size_t size, long) {
+    using ScalarT = TypeParam;
+    const size_t pb = std::max<size_t>(1, size / panels);
+    const size_t steps = ((size + pb - 1) / pb) * ((size + pb - 1) / pb);
+    const size_t b_panels = (size + pb - 1) / pb;
+    ScalarT alpha(1.5), beta(0.5);
+    ScalarT *a = new_data<ScalarT>(size * size);
+    ScalarT *b = new_data<ScalarT>(size * size);
+    ScalarT *c = new_data<ScalarT>(size * size);
+
+    // resident buffers of the size of one block, for the baselines
+    std::vector<ScalarT> host_panel(pb * size);
+    auto a_gpu = ex.template allocate<ScalarT>(pb * size);
+    auto b_gpu = ex.template allocate<ScalarT>(size * pb);
+    auto c_gpu = ex.template allocate<ScalarT>(pb * pb);
+    ex.copy_to_device(a, a_gpu, pb * size);
+    ex.copy_to_device(b, b_gpu, size * pb);
+    ex.copy_to_device(c, c_gpu, pb * pb);
+
+    const double transfer_ns = median_ns([&]() {
+      for (size_t s = 0; s < steps; s++) {
+        ex.copy_to_device_async(host_panel.data(), a_gpu, pb * size);
+        if (s < b_panels) {
+          ex.copy_to_device_async(host_panel.data(), b_gpu, size * pb);
+        }
+        ex.copy_to_device_async(host_panel.data(), c_gpu, pb * pb);
+        ex.copy_to_host_async(c_gpu, host_panel.data(), pb * pb);
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+    const double compute_ns = median_ns([&]() {
+      for (size_t s = 0; s < steps; s++) {
+        _gemm(ex, 'n', 'n', pb, pb, size, alpha, a_gpu, pb, b_gpu, size, beta,
+              c_gpu, pb);
+      }
+      ex.sycl_queue().wait_and_throw();
+    });
+
+    const size_t flops = 2 * size * size * size;
+    const size_t bytes =
+        (steps * (pb * size + 2 * pb * pb) + b_panels * size * pb) *
+        sizeof(ScalarT);
+    auto result = benchmark<>::measure(no_reps, flops, bytes, [&]() {
+      _gemm_streaming(ex, 'n', 'n', size, size, size, alpha, a, size, b, size,
+                      beta, c, size, pb, pb, Stages);
+    });
+
+    ex.template deallocate<ScalarT>(a_gpu);
+    ex.template deallocate<ScalarT>(b_gpu);
+    ex.template deallocate<ScalarT>(c_gpu);
+    release_data(a);
+    release_data(b);
+    release_data(c);
+
+    const double hidden = transfer_ns + compute_ns - result.stats.mean;
+    const double shorter = std::min(transfer_ns, compute_ns);
+    const double overlap =
+        shorter > 0 ? std::max(0.0, std::min(1.0, hidden / shorter)) : 0;
+
+    result.shape = "m=n=k=" + std::to_string(size) +
+                   ",panel=" + std::to_string(pb) +
+                   ",stages=" + std::to_string(Stages);
+    result.counters.emplace_back("transfer_ns", transfer_ns);
+    result.counters.emplace_back("compute_ns", compute_ns);
+    result.counters.emplace_back("overlap", overlap);
+    return result;
+  }
+};
+
+int main(int argc, char *argv[]) {
+  benchmark_args args;
+  if (!args.parse(argc, argv)) return 1;
+  lazy_benchmarker<SyclBlasStreamingBenchmarker<SYCL>> blasbenchmark(
+      [&]() { return new SyclBlasStreamingBenchmarker<SYCL>(args.device); });
+  benchmark_registry registry;
+  const auto sizes = benchmark_sizes(256, 4096);
+
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_streaming_float", sizes,
+                     streaming_bench<float, 1>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_streaming_float", sizes,
+                     streaming_bench<float, 2>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_streaming_float", sizes,
+                     streaming_bench<float, 3>);
+  BENCHMARK_REGISTER(registry, blasbenchmark, "gemm_streaming_double", sizes,
+                     streaming_bench<double, 2>);
+
+  return registry.run(args);
+}
@@ -274,6 +274,17 @@ function(__build_spir targetName sourceFile binaryDir fileCounter)
   # Convert argument list format
   separate_arguments(COMPUTECPP_DEVICE_COMPILER_FLAGS)
 
+  # Pass the compile definitions of the target to the device compiler too,
+  # including the INTERFACE ones of the libraries it links, so that both
+  # passes see the same code. They are only known at generation time, and a
+  # generator expression cannot expand to several arguments of the command,
+  # so they are written to a response file.
+  set(deviceDefinitionsFile
+    ${binaryDir}/${targetName}_${sourceFileName}_${fileCounter}.defs)
+  set(targetDefinitions "$<TARGET_PROPERTY:${targetName},COMPILE_DEFINITIONS>")
+  file(GENERATE OUTPUT ${deviceDefinitionsFile} CONTENT
+    "$<$<BOOL:${targetDefinitions}>:-D$<JOIN:${targetDefinitions},\n-D>\n>")
+
   # Add custom command for running compute++
   add_custom_command(
     OUTPUT ${outputSyclFile}
@@ -282,9 +293,10 @@ function(__build_spir targetName sourceFile binaryDir fileCounter)
             -isystem ${COMPUTECPP_INCLUDE_DIRECTORY}
             ${COMPUTECPP_PLATFORM_SPECIFIC_ARGS}
             ${device_compiler_includes}
+            @${deviceDefinitionsFile}
             -o ${outputSyclFile}
             -c ${sourceFile}
-    DEPENDS ${sourceFile}
+    DEPENDS ${sourceFile} ${deviceDefinitionsFile}
     IMPLICIT_DEPENDS CXX ${sourceFile}
     WORKING_DIRECTORY ${binaryDir}
     COMMENT "Building ComputeCpp integration header file ${outputSyclFile}")
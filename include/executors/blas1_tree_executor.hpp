@@ -230,6 +230,10 @@ struct Evaluate<vector_view<ScalarT, bufferT<ScalarT>>> {
 
 /*! Evaluate<matrix_view<ScalarT, bufferT<ScalarT>>>
  * @brief See Evaluate.
+ * The accessor covers the whole buffer: with a leading dimension larger
+ * than the number of rows, a view on a block of a larger matrix spans more
+ * than getSize() elements past its displacement. The displacement is kept
+ * in the view and applied on every access.
  */
 template <typename ScalarT>
 struct Evaluate<matrix_view<ScalarT, bufferT<ScalarT>>> {
@@ -246,8 +250,7 @@ struct Evaluate<matrix_view<ScalarT, bufferT<ScalarT>>> {
     auto nested =
         t.getData()
             .template get_access<cl::sycl::access::mode::read_write,
-                                 cl::sycl::access::target::global_buffer>(
-                h, cl::sycl::range<1>(t.getSize()), cl::sycl::id<1>(t.disp_));
+                                 cl::sycl::access::target::global_buffer>(h);
     return type(nested, t.accessDev_, t.sizeR_, t.sizeC_, t.accessOpr_,
                 t.sizeL_, t.disp_);
   }
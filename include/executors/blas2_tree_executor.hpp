@@ -165,6 +165,213 @@ struct Evaluate<ModifRank1<RHS1, RHS2, RHS3>> {
   }
 };
 
+/**** SPARSE MATRIX VECTOR PRODUCT ****/
+/*! Evaluate<csr_view>
+ * @brief See Evaluate.
+ */
+template <typename RowPtrT, typename ColIdxT, typename ValT>
+struct Evaluate<csr_view<RowPtrT, ColIdxT, ValT>> {
+  using value_type = typename ValT::value_type;
+  using rowptr_type = typename Evaluate<RowPtrT>::type;
+  using colidx_type = typename Evaluate<ColIdxT>::type;
+  using val_type = typename Evaluate<ValT>::type;
+  using input_type = csr_view<RowPtrT, ColIdxT, ValT>;
+  using type = csr_view<rowptr_type, colidx_type, val_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rowPtr = Evaluate<RowPtrT>::convert_to(v.rowPtr_, h);
+    auto colIdx = Evaluate<ColIdxT>::convert_to(v.colIdx_, h);
+    auto val = Evaluate<ValT>::convert_to(v.val_, h);
+    return type(rowPtr, colIdx, val, v.sizeC_);
+  }
+};
+
+/*! Evaluate<sell_view>
+ * @brief See Evaluate.
+ */
+template <typename SlicePtrT, typename ColIdxT, typename ValT>
+struct Evaluate<sell_view<SlicePtrT, ColIdxT, ValT>> {
+  using value_type = typename ValT::value_type;
+  using sliceptr_type = typename Evaluate<SlicePtrT>::type;
+  using colidx_type = typename Evaluate<ColIdxT>::type;
+  using val_type = typename Evaluate<ValT>::type;
+  using input_type = sell_view<SlicePtrT, ColIdxT, ValT>;
+  using type = sell_view<sliceptr_type, colidx_type, val_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto slicePtr = Evaluate<SlicePtrT>::convert_to(v.slicePtr_, h);
+    auto colIdx = Evaluate<ColIdxT>::convert_to(v.colIdx_, h);
+    auto val = Evaluate<ValT>::convert_to(v.val_, h);
+    return type(slicePtr, colIdx, val, v.sizeR_, v.sizeC_, v.sliceSz_);
+  }
+};
+
+/*! Evaluate<PrdRowCsrVct>.
+ * @brief See Evaluate.
+ */
+template <typename RHS1, typename RHS2>
+struct Evaluate<PrdRowCsrVct<RHS1, RHS2>> {
+  using value_type = typename RHS2::value_type;
+  using rhs1_type = typename Evaluate<RHS1>::type;
+  using rhs2_type = typename Evaluate<RHS2>::type;
+  using input_type = PrdRowCsrVct<RHS1, RHS2>;
+  using type = PrdRowCsrVct<rhs1_type, rhs2_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rhs1 = Evaluate<RHS1>::convert_to(v.r1, h);
+    auto rhs2 = Evaluate<RHS2>::convert_to(v.r2, h);
+    return type(rhs1, rhs2);
+  }
+};
+
+/*! Evaluate<PrdRowCsrVctMult>.
+ * @brief See Evaluate.
+ */
+template <typename LHS, typename RHS1, typename RHS2, typename RHS3>
+struct Evaluate<PrdRowCsrVctMult<LHS, RHS1, RHS2, RHS3>> {
+  using value_type = typename RHS2::value_type;
+  using lhs_type = typename Evaluate<LHS>::type;
+  using rhs1_type = typename Evaluate<RHS1>::type;
+  using rhs2_type = typename Evaluate<RHS2>::type;
+  using rhs3_type = typename Evaluate<RHS3>::type;
+  using cont_type = typename Evaluate<LHS>::cont_type;
+  using input_type = PrdRowCsrVctMult<LHS, RHS1, RHS2, RHS3>;
+  using type = PrdRowCsrVctMult<lhs_type, rhs1_type, rhs2_type, rhs3_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto lhs = Evaluate<LHS>::convert_to(v.l, h);
+    auto rhs1 = Evaluate<RHS1>::convert_to(v.r1, h);
+    auto rhs2 = Evaluate<RHS2>::convert_to(v.r2, h);
+    auto rhs3 = Evaluate<RHS3>::convert_to(v.r3, h);
+    return type(lhs, v.scl, rhs1, rhs2, rhs3, v.nThr);
+  }
+};
+
+/*! Evaluate<PrdRowSellVct>.
+ * @brief See Evaluate.
+ */
+template <typename RHS1, typename RHS2>
+struct Evaluate<PrdRowSellVct<RHS1, RHS2>> {
+  using value_type = typename RHS2::value_type;
+  using rhs1_type = typename Evaluate<RHS1>::type;
+  using rhs2_type = typename Evaluate<RHS2>::type;
+  using input_type = PrdRowSellVct<RHS1, RHS2>;
+  using type = PrdRowSellVct<rhs1_type, rhs2_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rhs1 = Evaluate<RHS1>::convert_to(v.r1, h);
+    auto rhs2 = Evaluate<RHS2>::convert_to(v.r2, h);
+    return type(rhs1, rhs2);
+  }
+};
+
+/**** BANDED AND PACKED MATRICES ****/
+/*! Evaluate<band_view>
+ * @brief See Evaluate.
+ */
+template <typename VectorT>
+struct Evaluate<band_view<VectorT>> {
+  using value_type = typename VectorT::value_type;
+  using vector_type = typename Evaluate<VectorT>::type;
+  using input_type = band_view<VectorT>;
+  using type = band_view<vector_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto data = Evaluate<VectorT>::convert_to(v.data_, h);
+    return type(data, v.sizeR_, v.sizeC_, v.kl_, v.ku_, v.sizeL_,
+                v.accessOpr_, v.symmetric_, v.unit_);
+  }
+};
+
+/*! Evaluate<packed_view>
+ * @brief See Evaluate.
+ */
+template <typename VectorT>
+struct Evaluate<packed_view<VectorT>> {
+  using value_type = typename VectorT::value_type;
+  using vector_type = typename Evaluate<VectorT>::type;
+  using input_type = packed_view<VectorT>;
+  using type = packed_view<vector_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto data = Evaluate<VectorT>::convert_to(v.data_, h);
+    return type(data, v.size_, v.upper_, v.accessOpr_, v.unit_);
+  }
+};
+
+/*! Evaluate<PrdRowBandVct>.
+ * @brief See Evaluate.
+ */
+template <typename RHS1, typename RHS2>
+struct Evaluate<PrdRowBandVct<RHS1, RHS2>> {
+  using value_type = typename RHS2::value_type;
+  using rhs1_type = typename Evaluate<RHS1>::type;
+  using rhs2_type = typename Evaluate<RHS2>::type;
+  using input_type = PrdRowBandVct<RHS1, RHS2>;
+  using type = PrdRowBandVct<rhs1_type, rhs2_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rhs1 = Evaluate<RHS1>::convert_to(v.r1, h);
+    auto rhs2 = Evaluate<RHS2>::convert_to(v.r2, h);
+    return type(rhs1, rhs2);
+  }
+};
+
+/*! Evaluate<SolveBandVct>.
+ * @brief See Evaluate.
+ */
+template <typename LHS, typename RHS1>
+struct Evaluate<SolveBandVct<LHS, RHS1>> {
+  using value_type = typename LHS::value_type;
+  using lhs_type = typename Evaluate<LHS>::type;
+  using rhs1_type = typename Evaluate<RHS1>::type;
+  using cont_type = typename Evaluate<LHS>::cont_type;
+  using input_type = SolveBandVct<LHS, RHS1>;
+  using type = SolveBandVct<lhs_type, rhs1_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto lhs = Evaluate<LHS>::convert_to(v.l, h);
+    auto rhs1 = Evaluate<RHS1>::convert_to(v.r1, h);
+    return type(lhs, rhs1);
+  }
+};
+
+/**** MATRIX REDUCTIONS ****/
+/*! Evaluate<TupleMatOp>.
+ * @brief See Evaluate.
+ */
+template <typename RHS>
+struct Evaluate<TupleMatOp<RHS>> {
+  using value_type = IndexValueTuple<typename RHS::value_type>;
+  using rhs_type = typename Evaluate<RHS>::type;
+  using input_type = TupleMatOp<RHS>;
+  using type = TupleMatOp<rhs_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rhs = Evaluate<RHS>::convert_to(v.r, h);
+    return type(rhs, v.byRows);
+  }
+};
+
+/*! Evaluate<ReductionMatVct>.
+ * @brief See Evaluate.
+ */
+template <typename Operator, typename LHS, typename RHS>
+struct Evaluate<ReductionMatVct<Operator, LHS, RHS>> {
+  using value_type = typename ReductionMatVct<Operator, LHS, RHS>::value_type;
+  using lhs_type = typename Evaluate<LHS>::type;
+  using rhs_type = typename Evaluate<RHS>::type;
+  using cont_type = typename Evaluate<LHS>::cont_type;
+  using input_type = ReductionMatVct<Operator, LHS, RHS>;
+  using type = ReductionMatVct<Operator, lhs_type, rhs_type>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto lhs = Evaluate<LHS>::convert_to(v.l, h);
+    auto rhs = Evaluate<RHS>::convert_to(v.r, h);
+    return type(lhs, rhs, v.byRows, v.nThr);
+  }
+};
+
 }  // namespace blas
 
 #endif  // BLAS2_TREE_EXECUTOR_HPP
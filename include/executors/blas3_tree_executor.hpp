@@ -46,16 +46,21 @@ struct Evaluate;
 /********************************/
 
 template <typename RHS1, typename RHS2, bool DoubleBuffer, bool NbcA, bool NbcB,
-          int ClSize, typename TileType, bool TransA, bool TransB, typename T>
+          int ClSize, typename TileType, bool TransA, bool TransB, typename T,
+          bool PackedA, bool PackedB, bool Pipeline, int VectorSize,
+          typename Raster>
 struct Evaluate<GemmFactory<RHS1, RHS2, DoubleBuffer, NbcA, NbcB, ClSize,
-                            TileType, TransA, TransB, T>> {
+                            TileType, TransA, TransB, T, PackedA, PackedB,
+                            Pipeline, VectorSize, Raster>> {
   using value_type = typename RHS1::value_type;
   using rhs1_type = typename Evaluate<RHS1>::type;
   using rhs2_type = typename Evaluate<RHS2>::type;
   using input_type = GemmFactory<RHS1, RHS2, DoubleBuffer, NbcA, NbcB, ClSize,
-                                 TileType, TransA, TransB, T>;
+                                 TileType, TransA, TransB, T, PackedA, PackedB,
+                                 Pipeline, VectorSize, Raster>;
   using type = GemmFactory<rhs1_type, rhs2_type, DoubleBuffer, NbcA, NbcB,
-                           ClSize, TileType, TransA, TransB, T>;
+                           ClSize, TileType, TransA, TransB, T, PackedA,
+                           PackedB, Pipeline, VectorSize, Raster>;
 
   static type convert_to(input_type v, cl::sycl::handler &h) {
     auto rhs1 = Evaluate<RHS1>::convert_to(v._A, h);
@@ -83,6 +88,41 @@ struct Evaluate<ReferenceGemmFactory<RHS1, RHS2, WgSize, TransA, TransB, T>> {
   }
 };
 
+template <typename RHS0, typename RHS1, typename RHS2, typename RHS3,
+          int WgSize, int ItemRows, bool TransA, bool TransB, bool PerChannel>
+struct Evaluate<QuantizedGemmFactory<RHS0, RHS1, RHS2, RHS3, WgSize, ItemRows,
+                                     TransA, TransB, PerChannel>> {
+  using value_type = int32_t;
+  using input_type = QuantizedGemmFactory<RHS0, RHS1, RHS2, RHS3, WgSize,
+                                          ItemRows, TransA, TransB, PerChannel>;
+  using type = QuantizedGemmFactory<
+      typename Evaluate<RHS0>::type, typename Evaluate<RHS1>::type,
+      typename Evaluate<RHS2>::type, typename Evaluate<RHS3>::type, WgSize,
+      ItemRows, TransA, TransB, PerChannel>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rhs1 = Evaluate<RHS0>::convert_to(v._A, h);
+    auto rhs2 = Evaluate<RHS1>::convert_to(v._B, h);
+    auto rhs3 = Evaluate<RHS2>::convert_to(v._C, h);
+    auto rhs4 = Evaluate<RHS3>::convert_to(v._S, h);
+    return type(rhs1, rhs2, rhs3, rhs4, v.a_zero, v.b_zero, v.c_zero);
+  }
+};
+
+template <typename RHS, bool PackB, bool Trans, int PanelSize, int ChunkSize>
+struct Evaluate<GemmPack<RHS, PackB, Trans, PanelSize, ChunkSize>> {
+  using value_type = typename RHS::value_type;
+  using rhs_type = typename Evaluate<RHS>::type;
+  using input_type = GemmPack<RHS, PackB, Trans, PanelSize, ChunkSize>;
+  using type = GemmPack<rhs_type, PackB, Trans, PanelSize, ChunkSize>;
+
+  static type convert_to(input_type v, cl::sycl::handler &h) {
+    auto rhs1 = Evaluate<RHS>::convert_to(v._X, h);
+    auto rhs2 = Evaluate<RHS>::convert_to(v._P, h);
+    return type(rhs1, rhs2);
+  }
+};
+
 }  // namespace blas
 
 #endif  // BLAS3_TREE_EXECUTOR_HPP
@@ -270,6 +270,14 @@ class Executor<SYCL> {
   inline bool has_local_memory() const {
     return q_interface.has_local_memory();
   }
+
+  /*!
+   * @brief true when the device works in place on registered host memory,
+   *        see register_host_memory.
+   */
+  inline bool is_host_unified_memory() const {
+    return q_interface.is_host_unified_memory();
+  }
   template <typename T>
   inline T *allocate(size_t num_elements) const {
     return q_interface.template allocate<T>(num_elements);
@@ -317,6 +325,57 @@ class Executor<SYCL> {
   inline void copy_to_host(T *src, T *dst, size_t size) {
     q_interface.copy_to_host(src, dst, size);
   }
+  /*  @brief Wraps num_elements of host memory in a pointer the routines
+      accept, without copying it when is_host_unified_memory() is true. The
+      host memory has to be accessed only after synchronize(ptr).
+  */
+  template <typename T>
+  inline T *register_host_memory(T *host, size_t num_elements) {
+    return q_interface.register_host_memory(host, num_elements);
+  }
+  /*  @brief Waits for the routines using registered memory, after which the
+      host memory holds their results and can be modified.
+  */
+  template <typename T>
+  inline void synchronize(T *ptr) {
+    q_interface.synchronize(ptr);
+  }
+  /*  @brief Synchronizes and releases a pointer of register_host_memory.
+  */
+  template <typename T>
+  inline void unregister_host_memory(T *ptr) {
+    q_interface.unregister_host_memory(ptr);
+  }
+  /*  @brief Asynchronous copy_to_device, src must not change until the
+      returned event completes.
+  */
+  template <typename T>
+  inline cl::sycl::event copy_to_device_async(T *src, T *dst, size_t size) {
+    return q_interface.copy_to_device_async(src, dst, size);
+  }
+  /*  @brief Asynchronous copy_to_host, dst holds the data once the returned
+      event completes.
+  */
+  template <typename T>
+  inline cl::sycl::event copy_to_host_async(T *src, T *dst, size_t size) {
+    return q_interface.copy_to_host_async(src, dst, size);
+  }
+
+  /*!
+   * @brief Builds the kernels of Routines ahead of their first call.
+   *
+   * The SYCL runtime compiles the program of a kernel online, the first time
+   * the kernel is submitted, which stalls the first call of every routine.
+   * Each of Routines, descriptors from blas::routine such as
+   * routine::gemm<float> or routine::dot<double>, runs its routine once on a
+   * small problem, and prepare() returns when they are all done.
+   */
+  template <typename... Routines>
+  inline void prepare() {
+    int expand[] = {0, (Routines::run(*this), 0)...};
+    (void)expand;
+    q_interface.sycl_queue().wait_and_throw();
+  }
 
   /*!
    * @brief Executes the tree without defining required shared memory.
@@ -646,6 +646,45 @@ void _rotmg(T &_d1, T &_d2, T &_x1, T &_y1, VectorSYCL<T> _param) {
 }
 #endif  // BLAS_EXPERIMENTAL
 
+/*!
+ * @brief Descriptors of the routines Executor::prepare builds ahead of time.
+ * run() calls the routine once on vectors of one element, which submits
+ * every kernel the routine uses whatever the size.
+ */
+namespace routine {
+
+#define SYCLBLAS_BLAS1_ROUTINE(_name, ...)                                     \
+  template <typename T>                                                        \
+  struct _name {                                                               \
+    template <typename ExecutorType>                                           \
+    static void run(Executor<ExecutorType> &ex) {                              \
+      const size_t n = 1;                                                      \
+      auto x = ex.template allocate<T>(n);                                     \
+      auto y = ex.template allocate<T>(n);                                     \
+      auto r = ex.template allocate<T>(1);                                     \
+      auto t = ex.template allocate<IndexValueTuple<T>>(1);                    \
+      __VA_ARGS__;                                                             \
+      ex.template deallocate<T>(x);                                            \
+      ex.template deallocate<T>(y);                                            \
+      ex.template deallocate<T>(r);                                            \
+      ex.template deallocate<IndexValueTuple<T>>(t);                           \
+    }                                                                          \
+  };
+
+SYCLBLAS_BLAS1_ROUTINE(axpy, _axpy(ex, n, T(1), x, 1, y, 1))
+SYCLBLAS_BLAS1_ROUTINE(copy, _copy(ex, n, x, 1, y, 1))
+SYCLBLAS_BLAS1_ROUTINE(swap, _swap(ex, n, x, 1, y, 1))
+SYCLBLAS_BLAS1_ROUTINE(scal, _scal(ex, n, T(1), x, 1))
+SYCLBLAS_BLAS1_ROUTINE(dot, _dot(ex, n, x, 1, y, 1, r))
+SYCLBLAS_BLAS1_ROUTINE(asum, _asum(ex, n, x, 1, r))
+SYCLBLAS_BLAS1_ROUTINE(nrm2, _nrm2(ex, n, x, 1, r))
+SYCLBLAS_BLAS1_ROUTINE(iamax, _iamax(ex, n, x, 1, t))
+SYCLBLAS_BLAS1_ROUTINE(iamin, _iamin(ex, n, x, 1, t))
+
+#undef SYCLBLAS_BLAS1_ROUTINE
+
+}  // namespace routine
+
 }  // namespace blas
 
 #endif  // BLAS1_INTERFACE_SYCL_HPP
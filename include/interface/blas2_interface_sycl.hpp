@@ -190,6 +190,435 @@ cl::sycl::event _ger(Executor<ExecutorType>& ex, size_t _M, size_t _N, T _alpha,
   return event;
 }
 
+/**** SPARSE MATRIX VECTOR PRODUCT ****/
+
+#define SPMV_MULT_ROW 8  // AVERAGE ROW LENGTH FOR SEVERAL THREADS PER ROW
+#define SPMV_MAX_THR 32  // MAXIMUM NUMBER OF THREADS PER ROW
+
+/*! _spmv.
+ * @brief Implementation of the Sparse Matrix Vector product, with the matrix
+ * in CSR format: y = alpha * A * x + beta * y.
+ * @param _M Number of rows of A.
+ * @param _N Number of columns of A.
+ * @param _nnz Number of nonzeros of A.
+ * @param _rowPtr Zero based row pointers, _M + 1 entries.
+ * @param _colIdx Column indices of the nonzeros.
+ * @param _val Values of the nonzeros.
+ * Short rows are computed by one thread each, the rows longer than
+ * SPMV_MULT_ROW on average by as many threads as the average length, up to
+ * SPMV_MAX_THR.
+ */
+template <typename ExecutorType, typename T, typename IndexT>
+cl::sycl::event _spmv(Executor<ExecutorType>& ex, size_t _M, size_t _N,
+                      size_t _nnz, T _alpha, IndexT* _rowPtr, IndexT* _colIdx,
+                      T* _val, T* _vx, size_t _incx, T _beta, T* _vy,
+                      size_t _incy) {
+  cl::sycl::event event;
+  using RHS =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  using IDX = vector_view<
+      IndexT, typename Executor<ExecutorType>::template ContainerT<IndexT> >;
+  auto _rowPtr_container = ex.get_buffer(_rowPtr);
+  IDX my_rowPtr(_rowPtr_container, ex.get_offset(_rowPtr), 1, _M + 1);
+  auto _colIdx_container = ex.get_buffer(_colIdx);
+  IDX my_colIdx(_colIdx_container, ex.get_offset(_colIdx), 1, _nnz);
+  auto _val_container = ex.get_buffer(_val);
+  RHS my_val(_val_container, ex.get_offset(_val), 1, _nnz);
+  csr_view<IDX, IDX, RHS> my_mA(my_rowPtr, my_colIdx, my_val, _N);
+  auto _vx_container = ex.get_buffer(_vx);
+  RHS my_vx(_vx_container, ex.get_offset(_vx), _incx, _N);
+  auto _vy_container = ex.get_buffer(_vy);
+  RHS my_vy(_vy_container, ex.get_offset(_vy), _incy, _M);
+
+  auto avgRow = (_M > 0) ? (_nnz / _M) : 0;
+  auto scalOp1 = make_op<ScalarOp, prdOp2_struct>(_beta, my_vy);
+  if (avgRow < SPMV_MULT_ROW) {
+    auto prdRowCsrVctOp = make_prdRowCsrVct(my_mA, my_vx);
+    auto scalOp2 = make_op<ScalarOp, prdOp2_struct>(_alpha, prdRowCsrVctOp);
+    auto addOp = make_op<BinaryOp, addOp2_struct>(scalOp1, scalOp2);
+    auto assignOp = make_op<Assign>(my_vy, addOp);
+    event = ex.execute(assignOp);
+  } else {
+    size_t nThr = 1;
+    while ((2 * nThr <= avgRow) && (2 * nThr <= SPMV_MAX_THR)) nThr *= 2;
+    auto prdRowCsrVctOp =
+        make_prdRowCsrVctMult(my_vy, _alpha, my_mA, my_vx, scalOp1, nThr);
+    size_t localSize = 256;
+    auto nWG = (_M + (localSize / nThr) - 1) / (localSize / nThr);
+    event = ex.execute(prdRowCsrVctOp, localSize, localSize * nWG, localSize);
+  }
+  return event;
+}
+
+/*! _spmv_sell.
+ * @brief Implementation of the Sparse Matrix Vector product, with the matrix
+ * in sliced ELLPACK format (see sell_view): y = alpha * A * x + beta * y.
+ * @param _M Number of rows of A.
+ * @param _N Number of columns of A.
+ * @param _sliceSz Number of rows of a slice.
+ * @param _nnz Number of entries stored, padding included.
+ * @param _slicePtr Zero based slice pointers, one more than slices.
+ * @param _colIdx Column indices, padding included.
+ * @param _val Values, padding included.
+ */
+template <typename ExecutorType, typename T, typename IndexT>
+cl::sycl::event _spmv_sell(Executor<ExecutorType>& ex, size_t _M, size_t _N,
+                           size_t _sliceSz, size_t _nnz, T _alpha,
+                           IndexT* _slicePtr, IndexT* _colIdx, T* _val, T* _vx,
+                           size_t _incx, T _beta, T* _vy, size_t _incy) {
+  using RHS =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  using IDX = vector_view<
+      IndexT, typename Executor<ExecutorType>::template ContainerT<IndexT> >;
+  auto nSlices = (_M + _sliceSz - 1) / _sliceSz;
+  auto _slicePtr_container = ex.get_buffer(_slicePtr);
+  IDX my_slicePtr(_slicePtr_container, ex.get_offset(_slicePtr), 1,
+                  nSlices + 1);
+  auto _colIdx_container = ex.get_buffer(_colIdx);
+  IDX my_colIdx(_colIdx_container, ex.get_offset(_colIdx), 1, _nnz);
+  auto _val_container = ex.get_buffer(_val);
+  RHS my_val(_val_container, ex.get_offset(_val), 1, _nnz);
+  sell_view<IDX, IDX, RHS> my_mA(my_slicePtr, my_colIdx, my_val, _M, _N,
+                                 _sliceSz);
+  auto _vx_container = ex.get_buffer(_vx);
+  RHS my_vx(_vx_container, ex.get_offset(_vx), _incx, _N);
+  auto _vy_container = ex.get_buffer(_vy);
+  RHS my_vy(_vy_container, ex.get_offset(_vy), _incy, _M);
+
+  auto scalOp1 = make_op<ScalarOp, prdOp2_struct>(_beta, my_vy);
+  auto prdRowSellVctOp = make_prdRowSellVct(my_mA, my_vx);
+  auto scalOp2 = make_op<ScalarOp, prdOp2_struct>(_alpha, prdRowSellVctOp);
+  auto addOp = make_op<BinaryOp, addOp2_struct>(scalOp1, scalOp2);
+  auto assignOp = make_op<Assign>(my_vy, addOp);
+  return ex.execute(assignOp);
+}
+
+/**** BAND AND PACKED MATRIX VECTOR PRODUCT ****/
+
+#define TBSV_MAX_THR 256  // MAXIMUM NUMBER OF THREADS OF THE SUBSTITUTION
+
+/*! _gbmv.
+ * @brief Implementation of the General Band Matrix Vector product,
+ * y = alpha * op(A) * x + beta * y, with the _KL subdiagonals and _KU
+ * superdiagonals of A in the BLAS band storage (see band_view).
+ */
+template <typename ExecutorType, typename T>
+cl::sycl::event _gbmv(Executor<ExecutorType>& ex, char _Trans, size_t _M,
+                      size_t _N, size_t _KL, size_t _KU, T _alpha, T* _mA,
+                      size_t _lda, T* _vx, size_t _incx, T _beta, T* _vy,
+                      size_t _incy) {
+  _Trans = tolower(_Trans);
+
+  if ((_Trans != 'n') && (_Trans != 't') && (_Trans != 'c'))
+    std::cout << "Erroneous parameter" << std::endl;
+  int accessOpr = (_Trans == 'n');
+
+  size_t M = (_Trans == 'n') ? _M : _N;
+  size_t N = (_Trans == 'n') ? _N : _M;
+  using RHS =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_data(_mA_container, ex.get_offset(_mA), 1, _lda * _N);
+  band_view<RHS> my_mA(my_data, _M, _N, _KL, _KU, _lda, accessOpr);
+  auto _vx_container = ex.get_buffer(_vx);
+  RHS my_vx(_vx_container, ex.get_offset(_vx), _incx, N);
+  auto _vy_container = ex.get_buffer(_vy);
+  RHS my_vy(_vy_container, ex.get_offset(_vy), _incy, M);
+
+  auto scalOp1 = make_op<ScalarOp, prdOp2_struct>(_beta, my_vy);
+  auto prdRowBandVctOp = make_prdRowBandVct(my_mA, my_vx);
+  auto scalOp2 = make_op<ScalarOp, prdOp2_struct>(_alpha, prdRowBandVctOp);
+  auto addOp = make_op<BinaryOp, addOp2_struct>(scalOp1, scalOp2);
+  auto assignOp = make_op<Assign>(my_vy, addOp);
+  return ex.execute(assignOp);
+}
+
+/*! _sbmv.
+ * @brief Implementation of the Symmetric Band Matrix Vector product,
+ * y = alpha * A * x + beta * y, with the _K superdiagonals (_Uplo = 'u') or
+ * subdiagonals (_Uplo = 'l') of A in the BLAS band storage.
+ */
+template <typename ExecutorType, typename T>
+cl::sycl::event _sbmv(Executor<ExecutorType>& ex, char _Uplo, size_t _N,
+                      size_t _K, T _alpha, T* _mA, size_t _lda, T* _vx,
+                      size_t _incx, T _beta, T* _vy, size_t _incy) {
+  _Uplo = tolower(_Uplo);
+
+  if ((_Uplo != 'u') && (_Uplo != 'l'))
+    std::cout << "Erroneous parameter" << std::endl;
+
+  using RHS =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_data(_mA_container, ex.get_offset(_mA), 1, _lda * _N);
+  band_view<RHS> my_mA(my_data, _N, _N, (_Uplo == 'u') ? 0 : _K,
+                       (_Uplo == 'u') ? _K : 0, _lda, 1, 1);
+  auto _vx_container = ex.get_buffer(_vx);
+  RHS my_vx(_vx_container, ex.get_offset(_vx), _incx, _N);
+  auto _vy_container = ex.get_buffer(_vy);
+  RHS my_vy(_vy_container, ex.get_offset(_vy), _incy, _N);
+
+  auto scalOp1 = make_op<ScalarOp, prdOp2_struct>(_beta, my_vy);
+  auto prdRowBandVctOp = make_prdRowBandVct(my_mA, my_vx);
+  auto scalOp2 = make_op<ScalarOp, prdOp2_struct>(_alpha, prdRowBandVctOp);
+  auto addOp = make_op<BinaryOp, addOp2_struct>(scalOp1, scalOp2);
+  auto assignOp = make_op<Assign>(my_vy, addOp);
+  return ex.execute(assignOp);
+}
+
+/*! _tpmv.
+ * @brief Implementation of the Triangular Packed Matrix Vector product,
+ * x = op(A) * x, with the triangle of A in the BLAS packed storage (see
+ * packed_view). The product is computed on a temporary vector, copied back
+ * to x.
+ */
+template <typename ExecutorType, typename T>
+cl::sycl::event _tpmv(Executor<ExecutorType>& ex, char _Uplo, char _Trans,
+                      char _Diag, size_t _N, T* _mAP, T* _vx, size_t _incx) {
+  _Uplo = tolower(_Uplo);
+  _Trans = tolower(_Trans);
+  _Diag = tolower(_Diag);
+
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Trans != 'n') && (_Trans != 't') && (_Trans != 'c')) ||
+      ((_Diag != 'u') && (_Diag != 'n')))
+    std::cout << "Erroneous parameter" << std::endl;
+
+  using RHS =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  auto _mAP_container = ex.get_buffer(_mAP);
+  RHS my_data(_mAP_container, ex.get_offset(_mAP), 1, _N * (_N + 1) / 2);
+  packed_view<RHS> my_mA(my_data, _N, (_Uplo == 'u'), (_Trans == 'n'),
+                         (_Diag == 'u'));
+  auto _vx_container = ex.get_buffer(_vx);
+  RHS my_vx(_vx_container, ex.get_offset(_vx), _incx, _N);
+  auto tmp_ptr = ex.template allocate<T>(_N);
+  auto tmp_container = ex.get_buffer(tmp_ptr);
+  RHS my_tmp(tmp_container, 0, 1, _N);
+
+  auto prdRowBandVctOp = make_prdRowBandVct(my_mA, my_vx);
+  auto assignOp1 = make_op<Assign>(my_tmp, prdRowBandVctOp);
+  ex.execute(assignOp1);
+  auto assignOp2 = make_op<Assign>(my_vx, my_tmp);
+  auto event = ex.execute(assignOp2);
+  ex.template deallocate<T>(tmp_ptr);
+  return event;
+}
+
+/*! _tbsv.
+ * @brief Implementation of the Triangular Band Solve, x = op(A)^-1 * x, with
+ * the _K superdiagonals (_Uplo = 'u') or subdiagonals (_Uplo = 'l') of A in
+ * the BLAS band storage. The substitution is sequential along the rows, so a
+ * single workgroup of up to TBSV_MAX_THR threads, one per entry of the band
+ * of a row, computes it.
+ */
+template <typename ExecutorType, typename T>
+cl::sycl::event _tbsv(Executor<ExecutorType>& ex, char _Uplo, char _Trans,
+                      char _Diag, size_t _N, size_t _K, T* _mA, size_t _lda,
+                      T* _vx, size_t _incx) {
+  cl::sycl::event event;
+  _Uplo = tolower(_Uplo);
+  _Trans = tolower(_Trans);
+  _Diag = tolower(_Diag);
+
+  if (((_Uplo != 'u') && (_Uplo != 'l')) ||
+      ((_Trans != 'n') && (_Trans != 't') && (_Trans != 'c')) ||
+      ((_Diag != 'u') && (_Diag != 'n')))
+    std::cout << "Erroneous parameter" << std::endl;
+  if (_N == 0) return event;
+
+  using RHS =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_data(_mA_container, ex.get_offset(_mA), 1, _lda * _N);
+  band_view<RHS> my_mA(my_data, _N, _N, (_Uplo == 'u') ? 0 : _K,
+                       (_Uplo == 'u') ? _K : 0, _lda, (_Trans == 'n'), 0,
+                       (_Diag == 'u'));
+  auto _vx_container = ex.get_buffer(_vx);
+  RHS my_vx(_vx_container, ex.get_offset(_vx), _incx, _N);
+
+  size_t localSize = 1;
+  while ((localSize < _K + 1) && (2 * localSize <= TBSV_MAX_THR))
+    localSize *= 2;
+  auto solveBandVctOp = make_solveBandVct(my_vx, my_mA);
+  event = ex.execute(solveBandVctOp, localSize, localSize, localSize);
+  return event;
+}
+
+/**** MATRIX REDUCTIONS ****/
+
+/*! _reduction_matrix.
+ * @brief Reduces with Operator each row (_Dim = 'r') or each column
+ * (_Dim = 'c') of the matrix expression r, which evaluates r.eval(i, j), into
+ * the entries of the vector view l, in a single kernel (see ReductionMatVct).
+ */
+template <typename Operator, typename ExecutorType, typename LHS,
+          typename RHS>
+cl::sycl::event _reduction_matrix(Executor<ExecutorType>& ex, char _Dim, LHS& l,
+                                  RHS& r) {
+  cl::sycl::event event;
+  _Dim = tolower(_Dim);
+
+  if ((_Dim != 'r') && (_Dim != 'c'))
+    std::cout << "Erroneous parameter" << std::endl;
+  int byRows = (_Dim == 'r');
+
+  size_t nSeg = byRows ? r.getSizeR() : r.getSizeC();
+  size_t segSz = byRows ? r.getSizeC() : r.getSizeR();
+  if (nSeg == 0) return event;
+  size_t localSize = 256;
+  size_t nThr = 1;
+  while ((2 * nThr <= segSz) && (2 * nThr <= localSize)) nThr *= 2;
+  auto reductionMatVctOp = make_reductionMatVct<Operator>(l, r, byRows, nThr);
+  auto nWG = (nSeg + (localSize / nThr) - 1) / (localSize / nThr);
+  event = ex.execute(reductionMatVctOp, localSize, localSize * nWG, localSize);
+  return event;
+}
+
+/*! _reduction_matrix.
+ * @brief Reduces with Operator each row (_Dim = 'r') or each column
+ * (_Dim = 'c') of the _M x _N matrix A into the vector r, of _M or _N
+ * entries.
+ */
+template <typename Operator, typename ExecutorType, typename T>
+cl::sycl::event _reduction_matrix(Executor<ExecutorType>& ex, char _Dim,
+                                  size_t _M, size_t _N, T* _mA, size_t _lda,
+                                  T* _vr, size_t _incr) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  using RHS1 =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_mA(_mA_container, _M, _N, 1, _lda, ex.get_offset(_mA));
+  auto _vr_container = ex.get_buffer(_vr);
+  RHS1 my_vr(_vr_container, ex.get_offset(_vr), _incr,
+             (tolower(_Dim) == 'r') ? _M : _N);
+  return _reduction_matrix<Operator>(ex, _Dim, my_vr, my_mA);
+}
+
+/*! _asum_matrix.
+ * @brief Sum of the absolute values of each row (_Dim = 'r') or each column
+ * (_Dim = 'c') of the _M x _N matrix A.
+ */
+template <typename ExecutorType, typename T>
+cl::sycl::event _asum_matrix(Executor<ExecutorType>& ex, char _Dim, size_t _M,
+                             size_t _N, T* _mA, size_t _lda, T* _vr,
+                             size_t _incr) {
+  return _reduction_matrix<addAbsOp2_struct>(ex, _Dim, _M, _N, _mA, _lda, _vr,
+                                             _incr);
+}
+
+/*! _nrm2_matrix.
+ * @brief Euclidean norm of each row (_Dim = 'r') or each column (_Dim = 'c')
+ * of the _M x _N matrix A.
+ */
+template <typename ExecutorType, typename T>
+cl::sycl::event _nrm2_matrix(Executor<ExecutorType>& ex, char _Dim, size_t _M,
+                             size_t _N, T* _mA, size_t _lda, T* _vr,
+                             size_t _incr) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  using RHS1 =
+      vector_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_mA(_mA_container, _M, _N, 1, _lda, ex.get_offset(_mA));
+  auto _vr_container = ex.get_buffer(_vr);
+  RHS1 my_vr(_vr_container, ex.get_offset(_vr), _incr,
+             (tolower(_Dim) == 'r') ? _M : _N);
+
+  auto prdOp = make_op<UnaryOp, prdOp1_struct>(my_mA);
+  _reduction_matrix<addOp2_struct>(ex, _Dim, my_vr, prdOp);
+  auto sqrtOp = make_op<UnaryOp, sqtOp1_struct>(my_vr);
+  auto assignOp = make_op<Assign>(my_vr, sqrtOp);
+  return ex.execute(assignOp);
+}
+
+/*! _iamax_matrix.
+ * @brief Index and value of the first element of maximum absolute value of
+ * each row (_Dim = 'r') or each column (_Dim = 'c') of the _M x _N matrix A.
+ * The index is the column of the element for a row, its row for a column.
+ */
+template <typename ExecutorType, typename T, typename I>
+cl::sycl::event _iamax_matrix(Executor<ExecutorType>& ex, char _Dim, size_t _M,
+                              size_t _N, T* _mA, size_t _lda, I* _vr,
+                              size_t _incr) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  using TupleVectorType =
+      vector_view<I, typename Executor<ExecutorType>::template ContainerT<I> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_mA(_mA_container, _M, _N, 1, _lda, ex.get_offset(_mA));
+  auto _vr_container = ex.get_buffer(_vr);
+  TupleVectorType my_vr(_vr_container, ex.get_offset(_vr), _incr,
+                        (tolower(_Dim) == 'r') ? _M : _N);
+
+  auto tupOp = make_tupleMatOp(my_mA, (tolower(_Dim) == 'r'));
+  return _reduction_matrix<maxIndOp2_struct>(ex, _Dim, my_vr, tupOp);
+}
+
+/*! _iamin_matrix.
+ * @brief Index and value of the first element of minimum absolute value of
+ * each row (_Dim = 'r') or each column (_Dim = 'c') of the _M x _N matrix A.
+ * The index is the column of the element for a row, its row for a column.
+ */
+template <typename ExecutorType, typename T, typename I>
+cl::sycl::event _iamin_matrix(Executor<ExecutorType>& ex, char _Dim, size_t _M,
+                              size_t _N, T* _mA, size_t _lda, I* _vr,
+                              size_t _incr) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T> >;
+  using TupleVectorType =
+      vector_view<I, typename Executor<ExecutorType>::template ContainerT<I> >;
+  auto _mA_container = ex.get_buffer(_mA);
+  RHS my_mA(_mA_container, _M, _N, 1, _lda, ex.get_offset(_mA));
+  auto _vr_container = ex.get_buffer(_vr);
+  TupleVectorType my_vr(_vr_container, ex.get_offset(_vr), _incr,
+                        (tolower(_Dim) == 'r') ? _M : _N);
+
+  auto tupOp = make_tupleMatOp(my_mA, (tolower(_Dim) == 'r'));
+  return _reduction_matrix<minIndOp2_struct>(ex, _Dim, my_vr, tupOp);
+}
+
+namespace routine {
+
+/*!
+ * @brief Builds the kernels of _gemv, both transpositions, see
+ *        Executor::prepare.
+ */
+template <typename T>
+struct gemv {
+  template <typename ExecutorType>
+  static void run(Executor<ExecutorType>& ex) {
+    auto a = ex.template allocate<T>(1);
+    auto x = ex.template allocate<T>(1);
+    auto y = ex.template allocate<T>(1);
+    _gemv(ex, 'n', 1, 1, T(1), a, 1, x, 1, T(0), y, 1);
+    _gemv(ex, 't', 1, 1, T(1), a, 1, x, 1, T(0), y, 1);
+    ex.template deallocate<T>(a);
+    ex.template deallocate<T>(x);
+    ex.template deallocate<T>(y);
+  }
+};
+
+/*!
+ * @brief Builds the kernels of _ger, see Executor::prepare.
+ */
+template <typename T>
+struct ger {
+  template <typename ExecutorType>
+  static void run(Executor<ExecutorType>& ex) {
+    auto a = ex.template allocate<T>(1);
+    auto x = ex.template allocate<T>(1);
+    auto y = ex.template allocate<T>(1);
+    _ger(ex, 1, 1, T(1), x, 1, y, 1, a, 1);
+    ex.template deallocate<T>(a);
+    ex.template deallocate<T>(x);
+    ex.template deallocate<T>(y);
+  }
+};
+
+}  // namespace routine
+
 }  // namespace blas
 
 #endif  // BLAS2_INTERFACE_SYCL_HPP
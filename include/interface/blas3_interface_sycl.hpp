@@ -28,9 +28,13 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #include <executors/executor_sycl.hpp>
@@ -41,10 +45,17 @@ namespace blas {
 /*!
  * @brief Select the correct transpose version of GemmFactory, depending on the
  *        runtime values of transpose.
+ *
+ * @tparam Pipeline  iff true, prefetch the next blocks of A and B into
+ *                   registers during the multiplication, see GemmFactory
+ * @tparam VectorSize  width of the vector accesses of internal tiles, see
+ *                     GemmFactory
+ * @tparam Raster  order of the work groups over C, see ColumnRaster
  */
 template <int WgSize, bool DoubleBuffer, bool ConflictA, bool ConflictB,
-          int ClSize, typename TileT, typename ExecutorType, typename T,
-          typename IndexType>
+          int ClSize, typename TileT, bool Pipeline = false,
+          int VectorSize = 1, typename Raster = ColumnRaster,
+          typename ExecutorType, typename T, typename IndexType>
 cl::sycl::event _select_gemm(Executor<ExecutorType>& ex, bool _TransA,
                              bool _TransB, IndexType _M, IndexType _N,
                              IndexType _K, T _alpha, T* _A, IndexType _lda,
@@ -63,8 +74,9 @@ cl::sycl::event _select_gemm(Executor<ExecutorType>& ex, bool _TransA,
   if (_TransA == _trans_a && _TransB == _trans_b) {                            \
     if (ex.has_local_memory()) {                                               \
       auto gemm = make_gemm<DoubleBuffer, ConflictA, ConflictB, ClSize, TileT, \
-                            _trans_a, _trans_b>(buffer_a, buffer_b, buffer_c,  \
-                                                T(_alpha), T(_beta));          \
+                            _trans_a, _trans_b, false, false, Pipeline,        \
+                            VectorSize, Raster>(                               \
+          buffer_a, buffer_b, buffer_c, T(_alpha), T(_beta));                  \
       event = ex.gemm_executor(gemm);                                          \
     } else {                                                                   \
       auto gemm = make_gemm_no_local_mem<WgSize, _trans_a, _trans_b>(          \
@@ -91,6 +103,12 @@ cl::sycl::event _select_gemm(Executor<ExecutorType>& ex, bool _TransA,
  *        "standard" BLAS gemm interface.
  *
  * See netlib.org/blas for details.
+ *
+ * A, B and C can be blocks of larger matrices, given as a pointer inside
+ * their allocation and the leading dimension of the enclosing matrix, so
+ * that blocked algorithms update them in place. Full tiles are read and
+ * written with vectors of 4 elements when the leading dimensions and the
+ * offsets of the operands are multiples of 4.
  */
 template <typename ExecutorType, typename T, typename IndexType>
 cl::sycl::event _gemm(Executor<ExecutorType>& ex, char _TransA, char _TransB,
@@ -108,6 +126,15 @@ cl::sycl::event _gemm(Executor<ExecutorType>& ex, char _TransA, char _TransB,
 
   bool _TrA = _TransA != 'n';
   bool _TrB = _TransB != 'n';
+
+  if (_lda < std::max<IndexType>(1, _TrA ? _K : _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  } else if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  }
+
 #define BIND_DATA_SIZE(_m, _n, _k) if (_M == (_m) && _N == (_n) && _K == (_k))
 
 #define BIND_DEFAULT
@@ -115,7 +142,7 @@ cl::sycl::event _gemm(Executor<ExecutorType>& ex, char _TransA, char _TransB,
 #define TO_TPARAMS(_wg, _db, _tir, _tic, _twr, _twc)                       \
   {                                                                        \
     return _select_gemm<_wg, _db, false, false, 64,                        \
-                        Tile<_tir, _tic, _twr, _twc>>(                     \
+                        Tile<_tir, _tic, _twr, _twc>, false, 4>(           \
         ex, _TrA, _TrB, _M, _N, _K, _alpha, _A, _lda, _B, _ldb, _beta, _C, \
         _ldc);                                                             \
   }
@@ -134,6 +161,898 @@ cl::sycl::event _gemm(Executor<ExecutorType>& ex, char _TransA, char _TransB,
 #undef TO_TPARAMS
 }
 
+/*!
+ * @brief Declares (_prefix = extern template) or defines (_prefix = template)
+ *        the instantiation of _gemm for one value and index type.
+ *
+ * The sycl_blas_gemm library, built from src/ with -DBUILD_GEMM_LIBRARY=ON,
+ * defines them for float and double and exports SYCL_BLAS_GEMM_LIBRARY to
+ * its users, so that their translation units link the kernels of every
+ * configuration of _gemm instead of compiling them again.
+ */
+#define SYCLBLAS_GEMM_INSTANTIATION(_prefix, _T, _IndexType)                  \
+  _prefix cl::sycl::event _gemm<SYCL, _T, _IndexType>(                        \
+      Executor<SYCL>& ex, char _TransA, char _TransB, _IndexType _M,          \
+      _IndexType _N, _IndexType _K, _T _alpha, _T* _A, _IndexType _lda,       \
+      _T* _B, _IndexType _ldb, _T _beta, _T* _C, _IndexType _ldc);
+
+namespace routine {
+
+/*!
+ * @brief Builds the kernels _gemm dispatches an _M x _N x _K problem to, in
+ *        the four transpositions, see Executor::prepare. The default shape
+ *        selects the default configuration of the device, the shapes bound
+ *        to their own configuration in _gemm have to be given.
+ */
+template <typename T, size_t _M = 1, size_t _N = 1, size_t _K = 1>
+struct gemm {
+  template <typename ExecutorType>
+  static void run(Executor<ExecutorType>& ex) {
+    // leading dimensions that are valid in every transposition
+    const size_t lda = std::max(_M, _K);
+    const size_t ldb = std::max(_K, _N);
+    auto a = ex.template allocate<T>(lda * lda);
+    auto b = ex.template allocate<T>(ldb * ldb);
+    auto c = ex.template allocate<T>(_M * _N);
+    for (auto trans : {"nn", "tn", "nt", "tt"}) {
+      _gemm(ex, trans[0], trans[1], _M, _N, _K, T(1), a, lda, b, ldb, T(0), c,
+            _M);
+    }
+    ex.template deallocate<T>(a);
+    ex.template deallocate<T>(b);
+    ex.template deallocate<T>(c);
+  }
+};
+
+}  // namespace routine
+
+#ifdef SYCL_BLAS_GEMM_LIBRARY
+SYCLBLAS_GEMM_INSTANTIATION(extern template, float, int)
+SYCLBLAS_GEMM_INSTANTIATION(extern template, float, size_t)
+SYCLBLAS_GEMM_INSTANTIATION(extern template, double, int)
+SYCLBLAS_GEMM_INSTANTIATION(extern template, double, size_t)
+#endif  // SYCL_BLAS_GEMM_LIBRARY
+
+/*!
+ * @brief Tile configuration of the packed GEMM routines below. The layout of
+ *        a packed operand depends on it, so the same one is used to pack and
+ *        to compute on a given device.
+ */
+template <typename T>
+struct GemmPacking {
+  static constexpr int cl_size = 64;
+  static constexpr int cl_elems = cl_size / sizeof(T);
+  using intel_tile = Tile<8, 8, 8, 8>;
+  using default_tile = Tile<8, 8, 16, 16>;
+};
+
+#define PACKED_GEMM_TILE(...)                                                 \
+  if (ex.get_device_type() == Queue_Interface<SYCL>::device_type::INTELGPU) { \
+    using TileT = typename GemmPacking<T>::intel_tile;                        \
+    __VA_ARGS__;                                                              \
+  } else {                                                                    \
+    using TileT = typename GemmPacking<T>::default_tile;                      \
+    __VA_ARGS__;                                                              \
+  }
+
+template <typename TileT, bool PackB, typename ExecutorType, typename T,
+          typename IndexType>
+cl::sycl::event _gemm_pack_impl(Executor<ExecutorType>& ex, bool _Trans,
+                                IndexType _R, IndexType _C, T* _X,
+                                IndexType _ldx, T* _P) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T>>;
+  constexpr int panel_size = PackB ? TileT::wg_cols * TileT::item_cols
+                                   : TileT::wg_rows * TileT::item_rows;
+  constexpr int chunk_size = GemmPacking<T>::cl_elems;
+  const IndexType size =
+      GemmPack<RHS, PackB, false, panel_size, chunk_size>::packed_size(_R, _C);
+  auto x_container = ex.get_buffer(_X);
+  RHS buffer_x(x_container, _R, _C, 0, _ldx, ex.get_offset(_X));
+  auto p_container = ex.get_buffer(_P);
+  RHS buffer_p(p_container, size, 1, 0, size, ex.get_offset(_P));
+  if (_Trans) {
+    return ex.execute(make_gemm_pack<PackB, true, panel_size, chunk_size>(
+        buffer_x, buffer_p));
+  } else {
+    return ex.execute(make_gemm_pack<PackB, false, panel_size, chunk_size>(
+        buffer_x, buffer_p));
+  }
+}
+
+/*!
+ * @brief Number of elements of A (_M x _K after transposition) once packed
+ *        by _gemm_pack_a.
+ */
+template <typename T, typename ExecutorType, typename IndexType>
+size_t _gemm_packed_size_a(Executor<ExecutorType>& ex, IndexType _M,
+                           IndexType _K) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T>>;
+  PACKED_GEMM_TILE(return GemmPack<RHS, false, false,
+                                   TileT::wg_rows * TileT::item_rows,
+                                   GemmPacking<T>::cl_elems>::packed_size(_M,
+                                                                          _K));
+}
+
+/*!
+ * @brief Number of elements of B (_K x _N after transposition) once packed
+ *        by _gemm_pack_b.
+ */
+template <typename T, typename ExecutorType, typename IndexType>
+size_t _gemm_packed_size_b(Executor<ExecutorType>& ex, IndexType _K,
+                           IndexType _N) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T>>;
+  PACKED_GEMM_TILE(return GemmPack<RHS, true, false,
+                                   TileT::wg_cols * TileT::item_cols,
+                                   GemmPacking<T>::cl_elems>::packed_size(_K,
+                                                                          _N));
+}
+
+/*!
+ * @brief Packs the left hand side operand of a GEMM, in the layout in which
+ *        the GEMM kernel stages it into local memory (see GemmPack).
+ *
+ * The result, in an allocation of _gemm_packed_size_a() elements, can be
+ * used by any number of _gemm_compute calls: the transposition and the
+ * strided loads are paid once instead of once per multiplication.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _gemm_pack_a(Executor<ExecutorType>& ex, char _TransA,
+                             IndexType _M, IndexType _K, T* _A,
+                             IndexType _lda, T* _packed_A) {
+  _TransA = tolower(_TransA);
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  }
+  const bool _TrA = _TransA != 'n';
+  if (_lda < std::max<IndexType>(1, _TrA ? _K : _M)) {
+    throw std::invalid_argument("invalid _lda");
+  }
+  PACKED_GEMM_TILE(return _gemm_pack_impl<TileT, false>(ex, _TrA, _M, _K, _A,
+                                                        _lda, _packed_A));
+}
+
+/*!
+ * @brief Packs the right hand side operand of a GEMM, see _gemm_pack_a.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _gemm_pack_b(Executor<ExecutorType>& ex, char _TransB,
+                             IndexType _K, IndexType _N, T* _B,
+                             IndexType _ldb, T* _packed_B) {
+  _TransB = tolower(_TransB);
+  if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  const bool _TrB = _TransB != 'n';
+  if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  }
+  PACKED_GEMM_TILE(return _gemm_pack_impl<TileT, true>(ex, _TrB, _K, _N, _B,
+                                                       _ldb, _packed_B));
+}
+
+template <typename TileT, bool TransB, bool PackedB, typename ExecutorType,
+          typename T, typename IndexType>
+cl::sycl::event _gemm_compute_impl(Executor<ExecutorType>& ex, IndexType _M,
+                                   IndexType _N, IndexType _K, T _alpha,
+                                   T* _packed_A, T* _B, IndexType _ldb,
+                                   T _beta, T* _C, IndexType _ldc) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T>>;
+  constexpr int cl_size = GemmPacking<T>::cl_size;
+  constexpr IndexType block_rows = TileT::wg_rows * TileT::item_rows;
+  if (!ex.has_local_memory()) {
+    throw std::runtime_error("packed GEMM needs local memory");
+  }
+  auto a_container = ex.get_buffer(_packed_A);
+  RHS buffer_a(a_container, _M, _K, 0, block_rows, ex.get_offset(_packed_A));
+  auto b_container = ex.get_buffer(_B);
+  RHS buffer_b(b_container, _K, _N, 0, _ldb, ex.get_offset(_B));
+  auto c_container = ex.get_buffer(_C);
+  RHS buffer_c(c_container, _M, _N, 0, _ldc, ex.get_offset(_C));
+  auto gemm = make_gemm<false, false, false, cl_size, TileT, false, TransB,
+                        true, PackedB>(buffer_a, buffer_b, buffer_c, T(_alpha),
+                                       T(_beta));
+  return ex.gemm_executor(gemm);
+}
+
+/*!
+ * @brief C = alpha * A * B + beta * C, with A and B packed by _gemm_pack_a
+ *        and _gemm_pack_b on the same executor.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _gemm_compute(Executor<ExecutorType>& ex, IndexType _M,
+                              IndexType _N, IndexType _K, T _alpha,
+                              T* _packed_A, T* _packed_B, T _beta, T* _C,
+                              IndexType _ldc) {
+  if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  }
+  PACKED_GEMM_TILE(return _gemm_compute_impl<TileT, false, true>(
+      ex, _M, _N, _K, _alpha, _packed_A, _packed_B,
+      static_cast<IndexType>(GemmPacking<T>::cl_elems), _beta, _C, _ldc));
+}
+
+/*!
+ * @brief C = alpha * A * op(B) + beta * C, with A packed by _gemm_pack_a on
+ *        the same executor and B in the usual column-major layout, for a
+ *        packed A multiplying many different B.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _gemm_compute(Executor<ExecutorType>& ex, char _TransB,
+                              IndexType _M, IndexType _N, IndexType _K,
+                              T _alpha, T* _packed_A, T* _B, IndexType _ldb,
+                              T _beta, T* _C, IndexType _ldc) {
+  _TransB = tolower(_TransB);
+  if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+  const bool _TrB = _TransB != 'n';
+  if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  } else if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  }
+  if (_TrB) {
+    PACKED_GEMM_TILE(return _gemm_compute_impl<TileT, true, false>(
+        ex, _M, _N, _K, _alpha, _packed_A, _B, _ldb, _beta, _C, _ldc));
+  } else {
+    PACKED_GEMM_TILE(return _gemm_compute_impl<TileT, false, false>(
+        ex, _M, _N, _K, _alpha, _packed_A, _B, _ldb, _beta, _C, _ldc));
+  }
+}
+
+#undef PACKED_GEMM_TILE
+
+/*!
+ * @brief Copy a rows x cols column-major block between two host matrices.
+ */
+template <typename T, typename IndexType>
+inline void _gemm_streaming_copy(const T* src, IndexType lds, T* dst,
+                                 IndexType ldd, IndexType rows,
+                                 IndexType cols) {
+  for (IndexType j = 0; j < cols; ++j) {
+    std::copy(src + j * lds, src + j * lds + rows, dst + j * ldd);
+  }
+}
+
+/*!
+ * @brief C = alpha * op(A) * op(B) + beta * C on host matrices that do not
+ *        need to fit in device memory.
+ *
+ * C is computed one _panel_m x _panel_n block at a time, from a
+ * _panel_m x K panel of op(A) and a K x _panel_n panel of op(B). Each block
+ * is staged through one of _stages sets of host and device buffers: its
+ * operands are packed on the host and copied asynchronously, multiplied by
+ * _gemm, and copied back, and the host moves on to the next block without
+ * waiting. The copies of a block thus overlap with the multiplication of
+ * the previous ones, as far as the device and the SYCL runtime can run
+ * transfers and kernels concurrently. A block of C is written to _C when its
+ * set of buffers is needed again, or at the end. The panel of op(B) is only
+ * copied when it changes.
+ *
+ * The device memory used is _stages * (_panel_m * K + K * _panel_n +
+ * _panel_m * _panel_n) elements. Returns once C has been written.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+void _gemm_streaming(Executor<ExecutorType>& ex, char _TransA, char _TransB,
+                     IndexType _M, IndexType _N, IndexType _K, T _alpha, T* _A,
+                     IndexType _lda, T* _B, IndexType _ldb, T _beta, T* _C,
+                     IndexType _ldc, IndexType _panel_m, IndexType _panel_n,
+                     int _stages = 2) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+
+  if (_lda < std::max<IndexType>(1, _TrA ? _K : _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  } else if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  } else if (_panel_m < 1 || _panel_n < 1) {
+    throw std::invalid_argument("invalid panel size");
+  } else if (_stages < 1) {
+    throw std::invalid_argument("invalid _stages");
+  }
+
+  if (_M == 0 || _N == 0) {
+    return;
+  }
+
+  const IndexType mb = std::min(_panel_m, _M);
+  const IndexType nb = std::min(_panel_n, _N);
+  const IndexType k = std::max<IndexType>(1, _K);
+
+  struct stage {
+    T* a;
+    T* b;
+    T* c;
+    std::vector<T> host_a, host_b, host_c;
+    cl::sycl::event done;
+    bool busy;
+    bool has_b;
+    IndexType i0, j0, rows, cols;
+  };
+  std::vector<stage> stages(_stages);
+  for (auto& s : stages) {
+    s.a = ex.template allocate<T>(mb * k);
+    s.b = ex.template allocate<T>(k * nb);
+    s.c = ex.template allocate<T>(mb * nb);
+    s.host_a.resize(mb * k);
+    s.host_b.resize(k * nb);
+    s.host_c.resize(mb * nb);
+    s.busy = false;
+    s.has_b = false;
+  }
+
+  // waits for the block in flight in s and writes it to C
+  auto retire = [&](stage& s) {
+    if (!s.busy) return;
+    s.done.wait_and_throw();
+    _gemm_streaming_copy(s.host_c.data(), s.rows, _C + s.i0 + s.j0 * _ldc,
+                         _ldc, s.rows, s.cols);
+    s.busy = false;
+  };
+
+  size_t step = 0;
+  for (IndexType j0 = 0; j0 < _N; j0 += nb) {
+    const IndexType cols = std::min(nb, _N - j0);
+    for (IndexType i0 = 0; i0 < _M; i0 += mb, ++step) {
+      const IndexType rows = std::min(mb, _M - i0);
+      auto& s = stages[step % stages.size()];
+      // the buffers of s are only reused once the block they hold, and so
+      // the copies that read them, are done
+      retire(s);
+
+      const IndexType lda = _TrA ? _K : rows;
+      if (_TrA) {
+        _gemm_streaming_copy(_A + i0 * _lda, _lda, s.host_a.data(), lda, _K,
+                             rows);
+      } else {
+        _gemm_streaming_copy(_A + i0, _lda, s.host_a.data(), lda, rows, _K);
+      }
+      ex.copy_to_device_async(s.host_a.data(), s.a, rows * _K);
+
+      const IndexType ldb = _TrB ? cols : _K;
+      if (!s.has_b || s.j0 != j0) {
+        if (_TrB) {
+          _gemm_streaming_copy(_B + j0, _ldb, s.host_b.data(), ldb, cols, _K);
+        } else {
+          _gemm_streaming_copy(_B + j0 * _ldb, _ldb, s.host_b.data(), ldb, _K,
+                               cols);
+        }
+        ex.copy_to_device_async(s.host_b.data(), s.b, _K * cols);
+        s.has_b = true;
+      }
+
+      _gemm_streaming_copy(_C + i0 + j0 * _ldc, _ldc, s.host_c.data(), rows,
+                           rows, cols);
+      ex.copy_to_device_async(s.host_c.data(), s.c, rows * cols);
+
+      _gemm(ex, _TransA, _TransB, rows, cols, _K, _alpha, s.a,
+            std::max<IndexType>(1, lda), s.b, std::max<IndexType>(1, ldb),
+            _beta, s.c, rows);
+      s.done = ex.copy_to_host_async(s.c, s.host_c.data(), rows * cols);
+      s.busy = true;
+      s.i0 = i0;
+      s.j0 = j0;
+      s.rows = rows;
+      s.cols = cols;
+    }
+  }
+
+  for (auto& s : stages) {
+    retire(s);
+    ex.template deallocate<T>(s.a);
+    ex.template deallocate<T>(s.b);
+    ex.template deallocate<T>(s.c);
+  }
+}
+
+/*!
+ * @brief Number of elements between the first and the last element of a
+ *        rows x cols column-major matrix with leading dimension ld.
+ */
+template <typename IndexType>
+inline IndexType _gemm_multi_span(IndexType rows, IndexType cols,
+                                  IndexType ld) {
+  return (rows == 0 || cols == 0) ? 0 : ld * (cols - 1) + rows;
+}
+
+/*!
+ * @brief C = alpha * op(A) * op(B) + beta * C on host matrices, with the
+ *        columns of C split between several executors, e.g. on different
+ *        devices, sub-devices or queues of the same device.
+ *
+ * Every executor receives a copy of A, the panel of op(B) and the panel of
+ * C of its columns, computes its panel with _gemm and copies it back. All
+ * the executors are started before waiting for any of them.
+ *
+ * The share of the columns of each executor is proportional to its entry in
+ * _throughput, in flops per second. Entries that are not known yet (zero)
+ * take the mean of the known ones, so the first call splits C evenly. Each
+ * entry is then updated with the throughput the executor reached in this
+ * call, transfers included, so that repeated calls converge to a balanced
+ * split.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+void _gemm_multi(const std::vector<Executor<ExecutorType>*>& executors,
+                 char _TransA, char _TransB, IndexType _M, IndexType _N,
+                 IndexType _K, T _alpha, T* _A, IndexType _lda, T* _B,
+                 IndexType _ldb, T _beta, T* _C, IndexType _ldc,
+                 std::vector<double>& _throughput) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+
+  if (_lda < std::max<IndexType>(1, _TrA ? _K : _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  } else if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  } else if (executors.empty()) {
+    throw std::invalid_argument("no executors");
+  }
+
+  const size_t count = executors.size();
+  _throughput.resize(count, 0.0);
+  if (_M == 0 || _N == 0) {
+    return;
+  }
+
+  double known = 0;
+  size_t num_known = 0;
+  for (auto t : _throughput) {
+    if (t > 0) {
+      known += t;
+      num_known++;
+    }
+  }
+  const double fallback = num_known > 0 ? known / num_known : 1.0;
+  double total = 0;
+  for (auto t : _throughput) total += t > 0 ? t : fallback;
+
+  // first column of each share, rounded from the cumulative weights
+  std::vector<IndexType> first(count + 1, 0);
+  double weight = 0;
+  for (size_t i = 0; i < count; ++i) {
+    weight += _throughput[i] > 0 ? _throughput[i] : fallback;
+    first[i + 1] = (i + 1 == count)
+                       ? _N
+                       : std::min<IndexType>(
+                             _N, static_cast<IndexType>(
+                                     std::llround(_N * (weight / total))));
+    first[i + 1] = std::max(first[i + 1], first[i]);
+  }
+
+  struct share {
+    T* a;
+    T* b;
+    T* c;
+    cl::sycl::event done;
+    std::chrono::steady_clock::time_point start;
+    double seconds;
+    bool running;
+  };
+  std::vector<share> shares(count);
+
+  // A, and the panels of B and C, are copied as the contiguous span of
+  // memory that holds them, so they keep their leading dimensions
+  const IndexType a_span =
+      _gemm_multi_span(_TrA ? _K : _M, _TrA ? _M : _K, _lda);
+  for (size_t i = 0; i < count; ++i) {
+    auto& ex = *executors[i];
+    auto& sh = shares[i];
+    const IndexType j0 = first[i];
+    const IndexType cols = first[i + 1] - j0;
+    sh.running = cols > 0;
+    if (!sh.running) continue;
+    T* b = _TrB ? _B + j0 : _B + j0 * _ldb;
+    T* c = _C + j0 * _ldc;
+    const IndexType b_span =
+        _gemm_multi_span(_TrB ? cols : _K, _TrB ? _K : cols, _ldb);
+    const IndexType c_span = _gemm_multi_span(_M, cols, _ldc);
+    sh.start = std::chrono::steady_clock::now();
+    sh.a = ex.template allocate<T>(std::max<IndexType>(1, a_span));
+    sh.b = ex.template allocate<T>(std::max<IndexType>(1, b_span));
+    sh.c = ex.template allocate<T>(c_span);
+    if (a_span > 0) ex.copy_to_device_async(_A, sh.a, a_span);
+    if (b_span > 0) ex.copy_to_device_async(b, sh.b, b_span);
+    ex.copy_to_device_async(c, sh.c, c_span);
+    _gemm(ex, _TransA, _TransB, _M, cols, _K, _alpha, sh.a, _lda, sh.b, _ldb,
+          _beta, sh.c, _ldc);
+    sh.done = ex.copy_to_host_async(sh.c, c, c_span);
+  }
+
+  // poll rather than wait in order, so that the time of each executor is
+  // taken when it finishes
+  size_t running = 0;
+  for (auto& sh : shares) running += sh.running;
+  while (running > 0) {
+    for (auto& sh : shares) {
+      if (sh.running &&
+          sh.done.template get_info<
+              cl::sycl::info::event::command_execution_status>() ==
+              cl::sycl::info::event_command_status::complete) {
+        sh.done.wait_and_throw();
+        sh.seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - sh.start)
+                         .count();
+        sh.running = false;
+        running--;
+      }
+    }
+    std::this_thread::yield();
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    const IndexType cols = first[i + 1] - first[i];
+    if (cols == 0) continue;
+    auto& ex = *executors[i];
+    auto& sh = shares[i];
+    ex.template deallocate<T>(sh.a);
+    ex.template deallocate<T>(sh.b);
+    ex.template deallocate<T>(sh.c);
+    const double measured =
+        sh.seconds > 0 ? 2.0 * _M * cols * std::max<IndexType>(1, _K) /
+                             sh.seconds
+                       : 0;
+    _throughput[i] =
+        _throughput[i] > 0 ? 0.5 * (_throughput[i] + measured) : measured;
+  }
+}
+
+/*!
+ * @brief _gemm_multi with an even split of the columns of C.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+void _gemm_multi(const std::vector<Executor<ExecutorType>*>& executors,
+                 char _TransA, char _TransB, IndexType _M, IndexType _N,
+                 IndexType _K, T _alpha, T* _A, IndexType _lda, T* _B,
+                 IndexType _ldb, T _beta, T* _C, IndexType _ldc) {
+  std::vector<double> throughput;
+  _gemm_multi(executors, _TransA, _TransB, _M, _N, _K, _alpha, _A, _lda, _B,
+              _ldb, _beta, _C, _ldc, throughput);
+}
+
+/*!
+ * @brief out = l op r, element-wise on rows x cols column-major blocks of
+ *        device allocations, out can be l or r.
+ */
+template <typename Operator, typename ExecutorType, typename T,
+          typename IndexType>
+cl::sycl::event _strassen_combine(Executor<ExecutorType>& ex, IndexType rows,
+                                  IndexType cols, T* l, IndexType ldl, T* r,
+                                  IndexType ldr, T* out, IndexType ldo) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T>>;
+  auto l_container = ex.get_buffer(l);
+  RHS view_l(l_container, rows, cols, 1, ldl, ex.get_offset(l));
+  auto r_container = ex.get_buffer(r);
+  RHS view_r(r_container, rows, cols, 1, ldr, ex.get_offset(r));
+  auto out_container = ex.get_buffer(out);
+  RHS view_out(out_container, rows, cols, 1, ldo, ex.get_offset(out));
+  auto op = make_op<BinaryOp, Operator>(view_l, view_r);
+  auto assignOp = make_op<Assign>(view_out, op);
+  return ex.execute(assignOp);
+}
+
+/*!
+ * @brief y = x + beta * y on rows x cols blocks, y is not read when beta is
+ *        zero.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _strassen_axpby(Executor<ExecutorType>& ex, IndexType rows,
+                                IndexType cols, T* x, IndexType ldx, T beta,
+                                T* y, IndexType ldy) {
+  using RHS =
+      matrix_view<T, typename Executor<ExecutorType>::template ContainerT<T>>;
+  auto x_container = ex.get_buffer(x);
+  RHS view_x(x_container, rows, cols, 1, ldx, ex.get_offset(x));
+  auto y_container = ex.get_buffer(y);
+  RHS view_y(y_container, rows, cols, 1, ldy, ex.get_offset(y));
+  if (beta == T(0)) {
+    auto assignOp = make_op<Assign>(view_y, view_x);
+    return ex.execute(assignOp);
+  }
+  auto scalOp = make_op<ScalarOp, prdOp2_struct>(beta, view_y);
+  auto addOp = make_op<BinaryOp, addOp2_struct>(view_x, scalOp);
+  auto assignOp = make_op<Assign>(view_y, addOp);
+  return ex.execute(assignOp);
+}
+
+/*!
+ * @brief One level of Strassen-Winograd, on the largest even part of the
+ *        problem, with the odd row, column and depth peeled off and done by
+ *        _gemm. The seven products recurse while levels remain and every
+ *        dimension is at least _cutoff.
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _gemm_strassen_impl(Executor<ExecutorType>& ex, char _TransA,
+                                    char _TransB, IndexType _M, IndexType _N,
+                                    IndexType _K, T _alpha, T* _A,
+                                    IndexType _lda, T* _B, IndexType _ldb,
+                                    T _beta, T* _C, IndexType _ldc,
+                                    int _levels, IndexType _cutoff) {
+  if (_levels < 1 || _M < _cutoff || _N < _cutoff || _K < _cutoff ||
+      _M < 2 || _N < 2 || _K < 2) {
+    return _gemm(ex, _TransA, _TransB, _M, _N, _K, _alpha, _A, _lda, _B, _ldb,
+                 _beta, _C, _ldc);
+  }
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+  const IndexType m2 = _M / 2;
+  const IndexType n2 = _N / 2;
+  const IndexType k2 = _K / 2;
+
+  // element (i, j) of op(A) and op(B), and block (i, j) of their 2 x 2 split
+  auto a_at = [&](IndexType i, IndexType j) {
+    return _TrA ? _A + j + i * _lda : _A + i + j * _lda;
+  };
+  auto b_at = [&](IndexType i, IndexType j) {
+    return _TrB ? _B + j + i * _ldb : _B + i + j * _ldb;
+  };
+  auto a_blk = [&](int i, int j) { return a_at(i * m2, j * k2); };
+  auto b_blk = [&](int i, int j) { return b_at(i * k2, j * n2); };
+  auto c_blk = [&](int i, int j) { return _C + i * m2 + j * n2 * _ldc; };
+
+  // the sums of blocks are stored like the operands, so that they are
+  // multiplied with the same transpositions
+  const IndexType a_rows = _TrA ? k2 : m2;
+  const IndexType a_cols = _TrA ? m2 : k2;
+  const IndexType b_rows = _TrB ? n2 : k2;
+  const IndexType b_cols = _TrB ? k2 : n2;
+  std::vector<T*> s(4), t(4);
+  for (auto& p : s) p = ex.template allocate<T>(a_rows * a_cols);
+  for (auto& p : t) p = ex.template allocate<T>(b_rows * b_cols);
+  T* p = ex.template allocate<T>(m2 * n2);
+
+  auto sum_a = [&](T* out, T* l, IndexType ldl, T* r, IndexType ldr,
+                   bool sub) {
+    if (sub) {
+      _strassen_combine<subOp2_struct>(ex, a_rows, a_cols, l, ldl, r, ldr, out,
+                                       a_rows);
+    } else {
+      _strassen_combine<addOp2_struct>(ex, a_rows, a_cols, l, ldl, r, ldr, out,
+                                       a_rows);
+    }
+  };
+  auto sum_b = [&](T* out, T* l, IndexType ldl, T* r, IndexType ldr,
+                   bool sub) {
+    if (sub) {
+      _strassen_combine<subOp2_struct>(ex, b_rows, b_cols, l, ldl, r, ldr, out,
+                                       b_rows);
+    } else {
+      _strassen_combine<addOp2_struct>(ex, b_rows, b_cols, l, ldl, r, ldr, out,
+                                       b_rows);
+    }
+  };
+  // S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2
+  sum_a(s[0], a_blk(1, 0), _lda, a_blk(1, 1), _lda, false);
+  sum_a(s[1], s[0], a_rows, a_blk(0, 0), _lda, true);
+  sum_a(s[2], a_blk(0, 0), _lda, a_blk(1, 0), _lda, true);
+  sum_a(s[3], a_blk(0, 1), _lda, s[1], a_rows, true);
+  // T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21
+  sum_b(t[0], b_blk(0, 1), _ldb, b_blk(0, 0), _ldb, true);
+  sum_b(t[1], b_blk(1, 1), _ldb, t[0], b_rows, true);
+  sum_b(t[2], b_blk(1, 1), _ldb, b_blk(0, 1), _ldb, true);
+  sum_b(t[3], t[1], b_rows, b_blk(1, 0), _ldb, true);
+
+  auto product = [&](T* a, IndexType lda, T* b, IndexType ldb, T alpha,
+                     T beta, T* c, IndexType ldc) {
+    return _gemm_strassen_impl(ex, _TransA, _TransB, m2, n2, k2, alpha, a,
+                               lda, b, ldb, beta, c, ldc, _levels - 1,
+                               _cutoff);
+  };
+  auto add_p = [&](T* c) {
+    _strassen_combine<addOp2_struct>(ex, m2, n2, c, _ldc, p, m2, c, _ldc);
+  };
+
+  // P1 = A11 B11 is part of every block of C, which is scaled by beta here
+  product(a_blk(0, 0), _lda, b_blk(0, 0), _ldb, _alpha, T(0), p, m2);
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      _strassen_axpby(ex, m2, n2, p, m2, _beta, c_blk(i, j), _ldc);
+    }
+  }
+  // P2 = A12 B21 only goes to C11, P3 = S4 B22 to C12 and P4 = A22 T4 to C21
+  product(a_blk(0, 1), _lda, b_blk(1, 0), _ldb, _alpha, T(1), c_blk(0, 0),
+          _ldc);
+  product(s[3], a_rows, b_blk(1, 1), _ldb, _alpha, T(1), c_blk(0, 1), _ldc);
+  product(a_blk(1, 1), _lda, t[3], b_rows, -_alpha, T(1), c_blk(1, 0), _ldc);
+  // P5 = S1 T1 goes to C12 and C22
+  product(s[0], a_rows, t[0], b_rows, _alpha, T(0), p, m2);
+  add_p(c_blk(0, 1));
+  add_p(c_blk(1, 1));
+  // P6 = S2 T2 goes to C12, C21 and C22
+  product(s[1], a_rows, t[1], b_rows, _alpha, T(0), p, m2);
+  add_p(c_blk(0, 1));
+  add_p(c_blk(1, 0));
+  add_p(c_blk(1, 1));
+  // P7 = S3 T3 goes to C21 and C22
+  product(s[2], a_rows, t[2], b_rows, _alpha, T(0), p, m2);
+  add_p(c_blk(1, 0));
+  auto event =
+      _strassen_combine<addOp2_struct>(ex, m2, n2, c_blk(1, 1), _ldc, p, m2,
+                                       c_blk(1, 1), _ldc);
+
+  // peeling: the last step of an odd depth, then the last row and column
+  // of C, which the even part has not touched
+  if (_K % 2) {
+    event = _gemm(ex, _TransA, _TransB, 2 * m2, 2 * n2, IndexType(1), _alpha,
+                  a_at(0, _K - 1), _lda, b_at(_K - 1, 0), _ldb, T(1), _C,
+                  _ldc);
+  }
+  if (_M % 2) {
+    event = _gemm(ex, _TransA, _TransB, IndexType(1), 2 * n2, _K, _alpha,
+                  a_at(_M - 1, 0), _lda, _B, _ldb, _beta, _C + _M - 1, _ldc);
+  }
+  if (_N % 2) {
+    event = _gemm(ex, _TransA, _TransB, _M, IndexType(1), _K, _alpha, _A,
+                  _lda, b_at(0, _N - 1), _ldb, _beta, _C + (_N - 1) * _ldc,
+                  _ldc);
+  }
+
+  // releasing a buffer waits for the kernels that use it
+  for (auto ptr : s) ex.template deallocate<T>(ptr);
+  for (auto ptr : t) ex.template deallocate<T>(ptr);
+  ex.template deallocate<T>(p);
+  return event;
+}
+
+/*!
+ * @brief Strassen-Winograd GEMM, C = alpha * op(A) * op(B) + beta * C on
+ *        device allocations.
+ *
+ * Each level splits the problem in 2 x 2 blocks and replaces 8 block
+ * products by 7 and 15 block additions, with workspace for the sums of
+ * blocks and one product taken from the executor. Levels are applied while
+ * every dimension is at least _cutoff, below it the products are plain
+ * _gemm calls. Strassen-Winograd trades accuracy for speed: the error bound
+ * grows with the number of levels and depends on the norms of A and B
+ * rather than on their elements, so this is only used when requested.
+ *
+ * @param _levels  maximum number of levels (1 or 2 are worth it in practice)
+ * @param _cutoff  smallest dimension a level is applied to, see the
+ *                 gemm_strassen benchmarks for the crossover with _gemm
+ */
+template <typename ExecutorType, typename T, typename IndexType>
+cl::sycl::event _gemm_strassen(Executor<ExecutorType>& ex, char _TransA,
+                               char _TransB, IndexType _M, IndexType _N,
+                               IndexType _K, T _alpha, T* _A, IndexType _lda,
+                               T* _B, IndexType _ldb, T _beta, T* _C,
+                               IndexType _ldc, int _levels = 1,
+                               IndexType _cutoff = 4096) {
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+
+  if (_lda < std::max<IndexType>(1, _TrA ? _K : _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  } else if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  }
+
+  return _gemm_strassen_impl(ex, _TransA, _TransB, _M, _N, _K, _alpha, _A,
+                             _lda, _B, _ldb, _beta, _C, _ldc, _levels,
+                             _cutoff);
+}
+
+/*!
+ * @brief Quantized GEMM on 8 bit integers,
+ *        C = scale * (op(A) - a_zero) * (op(B) - b_zero) + c_zero,
+ *        accumulated in 32 bit integers and rounded and saturated to the type
+ *        of C, see QuantizedGemmFactory.
+ *
+ * A, B and C can each be int8_t or uint8_t. _scale points to one scale, or
+ * to _N scales, one per column of C, when _per_channel is true. It is
+ * usually the product of the scales of A and B over the scale of C.
+ */
+template <typename ExecutorType, typename TA, typename TB, typename TC,
+          typename TS, typename IndexType>
+cl::sycl::event _gemm_quantized(Executor<ExecutorType>& ex, char _TransA,
+                                char _TransB, IndexType _M, IndexType _N,
+                                IndexType _K, TA* _A, IndexType _lda,
+                                int32_t _a_zero, TB* _B, IndexType _ldb,
+                                int32_t _b_zero, TS* _scale, bool _per_channel,
+                                TC* _C, IndexType _ldc, int32_t _c_zero) {
+  static_assert(std::is_integral<TA>::value && sizeof(TA) == 1 &&
+                    std::is_integral<TB>::value && sizeof(TB) == 1 &&
+                    std::is_integral<TC>::value && sizeof(TC) == 1,
+                "quantized GEMM works on 8 bit integers");
+  static_assert(std::is_floating_point<TS>::value,
+                "quantization scales are floating point");
+  _TransA = tolower(_TransA);
+  _TransB = tolower(_TransB);
+
+  if (_TransA != 'n' && _TransA != 't' && _TransA != 'c') {
+    throw std::invalid_argument("invalid _TransA");
+  } else if (_TransB != 'n' && _TransB != 't' && _TransB != 'c') {
+    throw std::invalid_argument("invalid _TransB");
+  }
+
+  const bool _TrA = _TransA != 'n';
+  const bool _TrB = _TransB != 'n';
+
+  if (_lda < std::max<IndexType>(1, _TrA ? _K : _M)) {
+    throw std::invalid_argument("invalid _lda");
+  } else if (_ldb < std::max<IndexType>(1, _TrB ? _N : _K)) {
+    throw std::invalid_argument("invalid _ldb");
+  } else if (_ldc < std::max<IndexType>(1, _M)) {
+    throw std::invalid_argument("invalid _ldc");
+  }
+
+  constexpr int wg_size = 128;
+  constexpr int item_rows = 4;
+  using ViewA =
+      matrix_view<TA, typename Executor<ExecutorType>::template ContainerT<TA>>;
+  using ViewB =
+      matrix_view<TB, typename Executor<ExecutorType>::template ContainerT<TB>>;
+  using ViewC =
+      matrix_view<TC, typename Executor<ExecutorType>::template ContainerT<TC>>;
+  using ViewS =
+      matrix_view<TS, typename Executor<ExecutorType>::template ContainerT<TS>>;
+  auto a_container = ex.get_buffer(_A);
+  ViewA buffer_a(a_container, _M, _K, 0, _lda, ex.get_offset(_A));
+  auto b_container = ex.get_buffer(_B);
+  ViewB buffer_b(b_container, _K, _N, 0, _ldb, ex.get_offset(_B));
+  auto c_container = ex.get_buffer(_C);
+  ViewC buffer_c(c_container, _M, _N, 0, _ldc, ex.get_offset(_C));
+  const IndexType scales = _per_channel ? _N : 1;
+  auto s_container = ex.get_buffer(_scale);
+  ViewS buffer_s(s_container, scales, 1, 0, scales, ex.get_offset(_scale));
+#define ENABLE_QUANTIZED_GEMM(_trans_a, _trans_b, _channel)                    \
+  if (_TrA == _trans_a && _TrB == _trans_b && _per_channel == _channel) {      \
+    auto gemm = make_quantized_gemm<wg_size, item_rows, _trans_a, _trans_b,    \
+                                    _channel>(buffer_a, buffer_b, buffer_c,    \
+                                              buffer_s, _a_zero, _b_zero,      \
+                                              _c_zero);                        \
+    return ex.gemm_executor(gemm);                                             \
+  }
+
+  ENABLE_QUANTIZED_GEMM(false, false, false);
+  ENABLE_QUANTIZED_GEMM(true, false, false);
+  ENABLE_QUANTIZED_GEMM(false, true, false);
+  ENABLE_QUANTIZED_GEMM(true, true, false);
+  ENABLE_QUANTIZED_GEMM(false, false, true);
+  ENABLE_QUANTIZED_GEMM(true, false, true);
+  ENABLE_QUANTIZED_GEMM(false, true, true);
+  ENABLE_QUANTIZED_GEMM(true, true, true);
+
+#undef ENABLE_QUANTIZED_GEMM
+  return cl::sycl::event();
+}
+
 }  // namespace blas
 
 #endif  // BLAS3_INTERFACE_SYCL_HPP
@@ -206,6 +206,7 @@ struct ScalarOp {
 
 /*! UnaryOp.
  * Implements a Unary Operation ( Op(z), e.g. z++), with z a vector.
+ * When z is a matrix, the operation can also be evaluated by row and column.
  */
 template <typename Operator, typename RHS>
 struct UnaryOp {
@@ -215,9 +216,15 @@ struct UnaryOp {
   UnaryOp(RHS &_r) : r(_r){};
 
   IndexType getSize() { return r.getSize(); }
+  IndexType getSizeR() { return r.getSizeR(); }
+  IndexType getSizeC() { return r.getSizeC(); }
 
   value_type eval(IndexType i) { return Operator::eval(r.eval(i)); }
 
+  value_type eval(IndexType i, IndexType j) {
+    return Operator::eval(r.eval(i, j));
+  }
+
   value_type eval(cl::sycl::nd_item<1> ndItem) {
     return eval(ndItem.get_global(0));
   }
@@ -437,6 +437,391 @@ ModifRank1<RHS1, RHS2, RHS3> make_modifRank1(RHS1 &r1, RHS2 &r2, RHS3 &r3) {
   return ModifRank1<RHS1, RHS2, RHS3>(r1, r2, r3);
 }
 
+/*! PrdRowCsrVct.
+ * @brief CSR SPMV, ONE ROW PER THREAD
+ * Each thread computes the dot product of a row of the csr_view r1 and r2.
+ * Like PrdRowMatVct it is an element of a vector expression, so it can be
+ * assigned, scaled, joined or reduced in the same kernel.
+ */
+template <class RHS1, class RHS2>
+struct PrdRowCsrVct {
+  using IndexType = typename RHS2::IndexType;
+  using value_type = typename RHS2::value_type;
+
+  RHS1 r1;
+  RHS2 r2;
+
+  PrdRowCsrVct(RHS1 &_r1, RHS2 &_r2) : r1(_r1), r2(_r2){};
+
+  value_type eval(IndexType i) {
+    auto val = iniAddOp1_struct::eval(r2.eval(0));
+    auto end = r1.getRowEnd(i);
+    for (IndexType k = r1.getRowBegin(i); k < end; k++) {
+      val += r1.eval(k) * r2.eval(r1.getCol(k));
+    }
+    return val;
+  }
+
+  value_type eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global(0));
+  }
+  IndexType getSize() { return r1.getSizeR(); }
+};
+
+template <class RHS1, class RHS2>
+PrdRowCsrVct<RHS1, RHS2> make_prdRowCsrVct(RHS1 &r1, RHS2 &r2) {
+  return PrdRowCsrVct<RHS1, RHS2>(r1, r2);
+}
+
+/** PrdRowCsrVctMult
+ * @brief CSR SPMV, nThr THREADS PER ROW
+ * The nThr consecutive threads of a row read its nonzeros together, which
+ * keeps the accesses coalescent on long rows, and reduce them on the shared
+ * memory. l = scl * r1 * r2 + r3.
+ */
+template <class LHS, class RHS1, class RHS2, class RHS3>
+struct PrdRowCsrVctMult {
+  using value_type = typename RHS2::value_type;
+  using IndexType = typename RHS2::IndexType;
+
+  LHS l;
+  value_type scl;
+
+  RHS1 r1;
+  RHS2 r2;
+  RHS3 r3;
+  IndexType nThr;
+
+  PrdRowCsrVctMult(LHS &_l, value_type _scl, RHS1 &_r1, RHS2 &_r2, RHS3 &_r3,
+                   IndexType _nThr)
+      : l(_l), scl(_scl), r1(_r1), r2(_r2), r3(_r3), nThr{_nThr} {};
+
+  value_type eval(IndexType i) {
+    auto val = iniAddOp1_struct::eval(r2.eval(0));
+    auto end = r1.getRowEnd(i);
+    for (IndexType k = r1.getRowBegin(i); k < end; k++) {
+      val += r1.eval(k) * r2.eval(r1.getCol(k));
+    }
+    l.eval(i) = scl * val + r3.eval(i);
+    return val;
+  }
+
+  template <typename sharedT>
+  value_type eval(sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+    IndexType localid = ndItem.get_local(0);
+    IndexType localSz = ndItem.get_local_range(0);
+    IndexType groupid = ndItem.get_group(0);
+
+    IndexType dimR = r1.getSizeR();
+
+    IndexType rowSz = (localSz / nThr);  // number of rows per each workgroup
+    IndexType rowid = groupid * rowSz + localid / nThr;  // rowid of the thread
+    IndexType lane = localid % nThr;  // first nonzero on which thread works
+
+    // Local computations
+    auto val = iniAddOp1_struct::eval(r2.eval(0));
+    if (rowid < dimR) {
+      auto end = r1.getRowEnd(rowid);
+      for (IndexType k = r1.getRowBegin(rowid) + lane; k < end; k += nThr) {
+        val += r1.eval(k) * r2.eval(r1.getCol(k));
+      }
+    }
+
+    scratch[localid] = val;
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    // Reduction inside the block
+    for (IndexType offset = nThr >> 1; offset > 0; offset >>= 1) {
+      if ((rowid < dimR) && (lane < offset)) {
+        scratch[localid] += scratch[localid + offset];
+      }
+      // This barrier is mandatory to be sure the data are on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    // The result is stored in lhs
+    if ((rowid < dimR) && (lane == 0)) {
+      l.eval(rowid) = scl * scratch[localid] + r3.eval(rowid);
+    }
+    return val;
+  }
+
+  IndexType getSize() { return r1.getSizeR(); }
+};
+
+template <class LHS, class RHS1, class RHS2, class RHS3, typename IndexType>
+PrdRowCsrVctMult<LHS, RHS1, RHS2, RHS3> make_prdRowCsrVctMult(
+    LHS &l, typename LHS::value_type scl, RHS1 &r1, RHS2 &r2, RHS3 &r3,
+    IndexType nThr) {
+  return PrdRowCsrVctMult<LHS, RHS1, RHS2, RHS3>(l, scl, r1, r2, r3, nThr);
+}
+
+/*! PrdRowSellVct.
+ * @brief SELL SPMV, ONE ROW PER THREAD
+ * Each thread computes the dot product of a row of the sell_view r1 and r2.
+ * The slices are column-major, so the threads of a slice read consecutive
+ * positions on every step.
+ */
+template <class RHS1, class RHS2>
+struct PrdRowSellVct {
+  using IndexType = typename RHS2::IndexType;
+  using value_type = typename RHS2::value_type;
+
+  RHS1 r1;
+  RHS2 r2;
+
+  PrdRowSellVct(RHS1 &_r1, RHS2 &_r2) : r1(_r1), r2(_r2){};
+
+  value_type eval(IndexType i) {
+    auto val = iniAddOp1_struct::eval(r2.eval(0));
+    auto len = r1.getRowLength(i);
+    auto k = r1.getIndex(i, 0);
+    for (IndexType j = 0; j < len; j++, k += r1.getSliceSz()) {
+      val += r1.eval(k) * r2.eval(r1.getCol(k));
+    }
+    return val;
+  }
+
+  value_type eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global(0));
+  }
+  IndexType getSize() { return r1.getSizeR(); }
+};
+
+template <class RHS1, class RHS2>
+PrdRowSellVct<RHS1, RHS2> make_prdRowSellVct(RHS1 &r1, RHS2 &r2) {
+  return PrdRowSellVct<RHS1, RHS2>(r1, r2);
+}
+
+/*! PrdRowBandVct.
+ * @brief BAND DOT PRODUCT GEMV
+ * Each thread computes the dot product of a row of r1 and r2, over the
+ * columns from r1.getRowBegin(i) to r1.getRowEnd(i) only: the band of a
+ * band_view or the triangle of a packed_view.
+ */
+template <class RHS1, class RHS2>
+struct PrdRowBandVct {
+  using IndexType = typename RHS2::IndexType;
+  using value_type = typename RHS2::value_type;
+
+  RHS1 r1;
+  RHS2 r2;
+
+  PrdRowBandVct(RHS1 &_r1, RHS2 &_r2) : r1(_r1), r2(_r2){};
+
+  value_type eval(IndexType i) {
+    auto val = iniAddOp1_struct::eval(r2.eval(0));
+    auto end = r1.getRowEnd(i);
+    for (IndexType j = r1.getRowBegin(i); j < end; j++) {
+      val += r1.eval(i, j) * r2.eval(j);
+    }
+    return val;
+  }
+
+  value_type eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global(0));
+  }
+  IndexType getSize() { return r1.getSizeR(); }
+};
+
+template <class RHS1, class RHS2>
+PrdRowBandVct<RHS1, RHS2> make_prdRowBandVct(RHS1 &r1, RHS2 &r2) {
+  return PrdRowBandVct<RHS1, RHS2>(r1, r2);
+}
+
+/*! SolveBandVct.
+ * @brief TRIANGULAR BAND SOLVE
+ * l = r1^-1 * l, for the triangular band_view r1. The rows are substituted
+ * one after the other by a single workgroup, whose threads share the dot
+ * product of the row with the band of l already solved.
+ */
+template <class LHS, class RHS1>
+struct SolveBandVct {
+  using IndexType = typename LHS::IndexType;
+  using value_type = typename LHS::value_type;
+
+  LHS l;
+  RHS1 r1;
+
+  SolveBandVct(LHS &_l, RHS1 &_r1) : l(_l), r1(_r1){};
+
+  // Forward substitution for a lower triangle, backward for an upper one
+  IndexType getRow(IndexType s) {
+    return (r1.getBandU() == 0) ? s : (r1.getSizeR() - 1 - s);
+  }
+
+  // The thread 0 substitutes the whole system
+  value_type eval(IndexType i) {
+    if (i == 0) {
+      for (IndexType s = 0; s < r1.getSizeR(); s++) {
+        auto row = getRow(s);
+        auto val = iniAddOp1_struct::eval(l.eval(0));
+        auto end = r1.getRowEnd(row);
+        for (IndexType j = r1.getRowBegin(row); j < end; j++) {
+          if (j != row) val += r1.eval(row, j) * l.eval(j);
+        }
+        l.eval(row) = (l.eval(row) - val) / r1.eval(row, row);
+      }
+    }
+    return l.eval(i);
+  }
+
+  template <typename sharedT>
+  value_type eval(sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+    IndexType localid = ndItem.get_local(0);
+    IndexType localSz = ndItem.get_local_range(0);
+
+    for (IndexType s = 0; s < r1.getSizeR(); s++) {
+      auto row = getRow(s);
+      auto val = iniAddOp1_struct::eval(l.eval(0));
+      auto end = r1.getRowEnd(row);
+      for (IndexType j = r1.getRowBegin(row) + localid; j < end;
+           j += localSz) {
+        if (j != row) val += r1.eval(row, j) * l.eval(j);
+      }
+      scratch[localid] = val;
+      // This barrier is mandatory to be sure the data is on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+      // Reduction inside the block
+      for (IndexType offset = localSz >> 1; offset > 0; offset >>= 1) {
+        if (localid < offset) {
+          scratch[localid] += scratch[localid + offset];
+        }
+        // This barrier is mandatory to be sure the data are on the shared
+        // memory
+        ndItem.barrier(cl::sycl::access::fence_space::local_space);
+      }
+      if (localid == 0) {
+        l.eval(row) = (l.eval(row) - scratch[0]) / r1.eval(row, row);
+      }
+      // The next rows read the one solved, and rewrite the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::global_and_local);
+    }
+    return l.eval(0);
+  }
+
+  IndexType getSize() { return r1.getSizeR(); }
+};
+
+template <class LHS, class RHS1>
+SolveBandVct<LHS, RHS1> make_solveBandVct(LHS &l, RHS1 &r1) {
+  return SolveBandVct<LHS, RHS1>(l, r1);
+}
+
+/*! TupleMatOp.
+ * @brief TupleOp of a matrix: the index of an element is its position in the
+ * row (byRows) or in the column (otherwise) it is reduced with.
+ */
+template <class RHS>
+struct TupleMatOp {
+  using IndexType = typename RHS::IndexType;
+  using value_type = IndexValueTuple<typename RHS::value_type>;
+  RHS r;
+  int byRows;
+
+  TupleMatOp(RHS &_r, int _byRows) : r(_r), byRows(_byRows){};
+
+  IndexType getSize() { return r.getSize(); }
+  IndexType getSizeR() { return r.getSizeR(); }
+  IndexType getSizeC() { return r.getSizeC(); }
+
+  value_type eval(IndexType i, IndexType j) {
+    return value_type(byRows ? j : i, r.eval(i, j));
+  }
+};
+
+template <class RHS>
+TupleMatOp<RHS> make_tupleMatOp(RHS &r, int byRows) {
+  return TupleMatOp<RHS>(r, byRows);
+}
+
+/*! ReductionMatVct.
+ * @brief SEGMENTED REDUCTION OF A MATRIX
+ * l(s) is the reduction with Operator of the row s of r (byRows) or of the
+ * column s (otherwise). nThr consecutive threads, a power of two, share each
+ * row or column, and reduce their values in local memory, so that a workgroup
+ * reduces localSize / nThr rows or columns at a time.
+ */
+template <typename Operator, class LHS, class RHS>
+struct ReductionMatVct {
+  using IndexType = typename LHS::IndexType;
+  using value_type = typename RHS::value_type;
+
+  LHS l;
+  RHS r;
+  int byRows;
+  IndexType nThr;
+
+  ReductionMatVct(LHS &_l, RHS &_r, int _byRows, IndexType _nThr)
+      : l(_l), r(_r), byRows(_byRows), nThr(_nThr){};
+
+  // Number of rows or columns reduced
+  IndexType getSize() { return byRows ? r.getSizeR() : r.getSizeC(); }
+
+  // Number of elements of each of them
+  IndexType getSegSize() { return byRows ? r.getSizeC() : r.getSizeR(); }
+
+  value_type evalSeg(IndexType s, IndexType k) {
+    return byRows ? r.eval(s, k) : r.eval(k, s);
+  }
+
+  value_type eval(IndexType s) {
+    auto val = Operator::init(r);
+    for (IndexType k = 0; k < getSegSize(); k++) {
+      val = Operator::eval(val, evalSeg(s, k));
+    }
+    l.eval(s) = val;
+    return val;
+  }
+
+  value_type eval(cl::sycl::nd_item<1> ndItem) {
+    return eval(ndItem.get_global(0));
+  }
+
+  template <typename sharedT>
+  value_type eval(sharedT scratch, cl::sycl::nd_item<1> ndItem) {
+    IndexType localid = ndItem.get_local(0);
+    IndexType localSz = ndItem.get_local_range(0);
+    IndexType groupid = ndItem.get_group(0);
+
+    IndexType thrid = localid % nThr;
+    IndexType s = groupid * (localSz / nThr) + localid / nThr;
+    IndexType segSz = getSegSize();
+
+    auto val = Operator::init(r);
+    if (s < getSize()) {
+      for (IndexType k = thrid; k < segSz; k += nThr) {
+        val = Operator::eval(val, evalSeg(s, k));
+      }
+    }
+    scratch[localid] = val;
+    // This barrier is mandatory to be sure the data is on the shared memory
+    ndItem.barrier(cl::sycl::access::fence_space::local_space);
+
+    // Reduction inside the threads of the row or column
+    for (IndexType offset = nThr >> 1; offset > 0; offset >>= 1) {
+      if (thrid < offset) {
+        scratch[localid] =
+            Operator::eval(scratch[localid], scratch[localid + offset]);
+      }
+      // This barrier is mandatory to be sure the data are on the shared memory
+      ndItem.barrier(cl::sycl::access::fence_space::local_space);
+    }
+    if ((thrid == 0) && (s < getSize())) {
+      l.eval(s) = scratch[localid];
+    }
+    return scratch[localid];
+  }
+};
+
+template <typename Operator, typename LHS, typename RHS, typename IndexType>
+ReductionMatVct<Operator, LHS, RHS> make_reductionMatVct(LHS &l, RHS &r,
+                                                         int byRows,
+                                                         IndexType nThr) {
+  return ReductionMatVct<Operator, LHS, RHS>(l, r, byRows, nThr);
+}
+
 }  // namespace blas
 
 #endif  // BLAS2_TREES_HPP
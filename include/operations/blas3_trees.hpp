@@ -27,6 +27,8 @@
 
 #include <CL/sycl.hpp>
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <type_traits>
 
@@ -45,6 +47,8 @@ struct type_string {
 
 ENABLE_TYPE_STRING(float)
 ENABLE_TYPE_STRING(double)
+ENABLE_TYPE_STRING(int8_t)
+ENABLE_TYPE_STRING(uint8_t)
 
 #undef ENABLE_TYPE_STRING
 
@@ -112,9 +116,9 @@ class ReferenceGemmFactory {
   }
   inline IndexType getSize() { return m * n; }
   inline void eval(cl::sycl::nd_item<1> id) noexcept {
-    auto A = _A.getData().get_pointer().get();
-    auto B = _B.getData().get_pointer().get();
-    auto C = _C.getData().get_pointer().get();
+    auto A = _A.getData().get_pointer().get() + _A.getDisp();
+    auto B = _B.getData().get_pointer().get() + _B.getDisp();
+    auto C = _C.getData().get_pointer().get() + _C.getDisp();
     IndexType item_id = id.get_global(0);
     //  printf("B[%ld]= %f\n", item_id, B[item_id]);
     if (item_id >= m * n) {
@@ -230,6 +234,110 @@ struct Tile {
   }
 };
 
+/*!
+ * @brief Rasterization policies of GemmFactory, which decide the order in
+ *        which consecutive work groups (more precisely, consecutive top-level
+ *        tiles) walk the grid of tiles of C.
+ *
+ * Work groups that run at the same time share the panels of A and B they
+ * read through the caches, so the order decides how much of A and B has to
+ * stay in cache for them to be reused. A policy provides:
+ *  - grid_size(), the number of tiles to launch for a grid of
+ *    tiles_per_col x tiles_per_row tiles (tiles outside of the grid are
+ *    skipped),
+ *  - map(), the row and the column in the grid of the id-th tile.
+ *
+ * ColumnRaster walks the grid in column-major order: consecutive tiles share
+ * a panel of B, but a column of tiles reads the whole of A.
+ */
+struct ColumnRaster {
+  template <typename IndexType>
+  static inline IndexType grid_size(IndexType tiles_per_col,
+                                    IndexType tiles_per_row) noexcept {
+    return tiles_per_col * tiles_per_row;
+  }
+
+  template <typename IndexType>
+  static inline void map(IndexType id, IndexType tiles_per_col, IndexType,
+                         IndexType &row, IndexType &col) noexcept {
+    row = id % tiles_per_col;
+    col = id / tiles_per_col;
+  }
+
+  static inline std::string get_type_string() noexcept {
+    return "ColumnRaster";
+  }
+};
+
+/*!
+ * @brief Walks the grid in groups of GroupRows rows of tiles, column-major
+ *        within a group, so that a group only reads GroupRows panels of A
+ *        while it goes over B.
+ *
+ * @tparam GroupRows  the number of rows of tiles in a group
+ */
+template <int GroupRows = 8>
+struct GroupedRaster {
+  static constexpr int group_rows = GroupRows;
+
+  template <typename IndexType>
+  static inline IndexType grid_size(IndexType tiles_per_col,
+                                    IndexType tiles_per_row) noexcept {
+    return tiles_per_col * tiles_per_row;
+  }
+
+  template <typename IndexType>
+  static inline void map(IndexType id, IndexType tiles_per_col,
+                         IndexType tiles_per_row, IndexType &row,
+                         IndexType &col) noexcept {
+    const IndexType group_size = group_rows * tiles_per_row;
+    const IndexType first_row = (id / group_size) * group_rows;
+    // the last group has fewer rows when group_rows does not divide the grid
+    const IndexType rows = tiles_per_col - first_row < group_rows
+                               ? tiles_per_col - first_row
+                               : group_rows;
+    row = first_row + (id % group_size) % rows;
+    col = (id % group_size) / rows;
+  }
+
+  static inline std::string get_type_string() noexcept {
+    return std::string("GroupedRaster<") + std::to_string(group_rows) + ">";
+  }
+};
+
+/*!
+ * @brief Walks the grid in Morton (Z) order, which keeps every power of two
+ *        number of consecutive tiles within a square-ish block of the grid.
+ *
+ * The curve covers the smallest power of two square enclosing the grid, so
+ * grids far from square launch many empty work groups.
+ */
+struct MortonRaster {
+  template <typename IndexType>
+  static inline IndexType grid_size(IndexType tiles_per_col,
+                                    IndexType tiles_per_row) noexcept {
+    IndexType side = 1;
+    while (side < tiles_per_col || side < tiles_per_row) side *= 2;
+    return side * side;
+  }
+
+  template <typename IndexType>
+  static inline void map(IndexType id, IndexType, IndexType, IndexType &row,
+                         IndexType &col) noexcept {
+    row = 0;
+    col = 0;
+    // even bits of the id are the row, odd bits the column
+    for (IndexType b = 0; b < IndexType(sizeof(IndexType) * 4); ++b) {
+      row |= ((id >> (2 * b)) & 1) << b;
+      col |= ((id >> (2 * b + 1)) & 1) << b;
+    }
+  }
+
+  static inline std::string get_type_string() noexcept {
+    return "MortonRaster";
+  }
+};
+
 /*!
  * @brief GemmFactory is a template class whose instantiations provide
  *        different implementations of the GEMM device function.
@@ -260,12 +368,33 @@ struct Tile {
  * @tparam TransA  iff true, matrix A will be transposed on the fly
  * @tparam TransB  iff true, matrix B will be transposed on the fly
  * @tparam T  type of matrix elements
+ * @tparam PackedA  iff true, A has been packed by GemmPack, one block_rows
+ *                  panel after the other (see GemmPack)
+ * @tparam PackedB  iff true, B has been packed by GemmPack, one block_cols
+ *                  panel after the other (see GemmPack)
+ * @tparam Pipeline  iff true, the global loads of the next blocks of A and B
+ *                   are issued into registers before the current blocks are
+ *                   multiplied, and committed to scratchpad memory after, so
+ *                   that their latency is hidden behind the arithmetic
+ *                   (costs prefetch_a_size + prefetch_b_size registers per
+ *                   item)
+ * @tparam VectorSize  width of the cl::sycl::vec used for the global memory
+ *                     accesses of internal tiles: blocks of non-transposed
+ *                     operands are loaded, and C is updated through
+ *                     scratchpad memory, VectorSize elements at a time when
+ *                     their leading dimension and offset allow it (1 disables
+ *                     it, the prefetching loads of Pipeline stay scalar)
+ * @tparam Raster  the order in which work groups walk the tiles of C, see
+ *                 ColumnRaster
  */
 template <typename RHS1, typename RHS2, bool DoubleBuffer, bool NbcA, bool NbcB,
-          int ClSize, typename TileType, bool TransA, bool TransB, typename T>
+          int ClSize, typename TileType, bool TransA, bool TransB, typename T,
+          bool PackedA = false, bool PackedB = false, bool Pipeline = false,
+          int VectorSize = 1, typename Raster = ColumnRaster>
 class GemmFactory {
  public:
   using tile_type = TileType;
+  using raster_type = Raster;
   using value_type = T;
   using IndexType = typename RHS1::IndexType;
   using Scratch = cl::sycl::accessor<T, 1, cl::sycl::access::mode::read_write,
@@ -286,6 +415,14 @@ class GemmFactory {
   static constexpr bool nbc_b = NbcB;
   static constexpr bool trans_a = TransA;
   static constexpr bool trans_b = TransB;
+  static constexpr bool packed_a = PackedA;
+  static constexpr bool packed_b = PackedB;
+  static constexpr bool pipeline = Pipeline;
+  static constexpr IndexType vector_size = VectorSize;
+
+  static_assert(!(packed_a && trans_a) && !(packed_b && trans_b),
+                "Packed operands are stored in the order they are loaded in,"
+                " they cannot be transposed on the fly");
 
   static constexpr IndexType cl_size = ClSize;
   //! @brief Number of elements which fit within a cache line.
@@ -325,6 +462,34 @@ class GemmFactory {
   //         work group
   static constexpr IndexType scratch_size =
       (double_buffer + 1) * (ldsa * cl_elems + ldsb * block_cols);
+  //! @brief number of elements of a block of A prefetched by each work item
+  static constexpr IndexType prefetch_a_size =
+      (block_rows * cl_elems - 1) / wg_size + 1;
+  //! @brief number of elements of a block of B prefetched by each work item
+  static constexpr IndexType prefetch_b_size =
+      (cl_elems * block_cols - 1) / wg_size + 1;
+
+  static_assert(vector_size == 1 || vector_size == 2 || vector_size == 4 ||
+                    vector_size == 8 || vector_size == 16,
+                "Vector size should be one of the cl::sycl::vec widths");
+
+  static_assert(block_rows % vector_size == 0 && cl_elems % vector_size == 0,
+                "The rows of the blocks should be whole vectors");
+
+  //! @brief true iff every block in scratchpad memory starts on a vector
+  static constexpr bool vector_smem_aligned =
+      vector_size > 1 && (block_cols * ldsb) % vector_size == 0 &&
+      (ldsa * cl_elems) % vector_size == 0;
+  //! @brief true iff blocks of A can be copied with vector accesses
+  static constexpr bool vector_a =
+      vector_smem_aligned && !trans_a && ldsa % vector_size == 0;
+  //! @brief true iff blocks of B can be copied with vector accesses
+  static constexpr bool vector_b =
+      vector_smem_aligned && !trans_b && ldsb % vector_size == 0;
+  //! @brief true iff a block_rows x wg_cols slice of C fits in scratchpad
+  //         memory, to be written with vector accesses
+  static constexpr bool vector_c =
+      vector_size > 1 && block_rows * wg_cols <= scratch_size;
 
   RHS1 _A;
   RHS1 _B;
@@ -358,7 +523,10 @@ class GemmFactory {
     return std::string("GemmFactory<") + std::to_string(double_buffer) + ", " +
            std::to_string(nbc_a) + ", " + std::to_string(nbc_b) + ", " +
            std::to_string(cl_size) + ", " + tile_type::get_type_string() +
-           ", " + type_string<value_type>::get_value() + ">";
+           ", " + type_string<value_type>::get_value() + ", " +
+           std::to_string(packed_a) + ", " + std::to_string(packed_b) + ", " +
+           std::to_string(pipeline) + ", " + std::to_string(vector_size) +
+           ", " + raster_type::get_type_string() + ">";
   }
 
   /*!
@@ -375,17 +543,17 @@ class GemmFactory {
    */
   static inline cl::sycl::nd_range<1> get_nd_range(IndexType m,
                                                    IndexType n) noexcept {
-    const cl::sycl::range<1> nwg(((m - 1) / big_tile_rows + 1) *
-                                 ((n - 1) / big_tile_cols + 1) * tl_rows *
-                                 tl_cols);
+    const IndexType tiles = raster_type::grid_size(
+        (m - 1) / big_tile_rows + 1, (n - 1) / big_tile_cols + 1);
+    const cl::sycl::range<1> nwg(tiles * tl_rows * tl_cols);
     const cl::sycl::range<1> wgs(wg_size);
+#ifdef VERBOSE
     std::cout << " M: " << m << " , N " << n
               << " , big_tile_rows: " << big_tile_rows
               << " , big_tile_cols: " << big_tile_cols
               << " , wg_size: " << wg_size << " , nwg : "
-              << ((m - 1) / big_tile_rows + 1) * ((n - 1) / big_tile_cols + 1) *
-                     tl_rows * tl_cols
-              << std::endl;
+              << tiles * tl_rows * tl_cols << std::endl;
+#endif  //  VERBOSE
     return cl::sycl::nd_range<1>(nwg * wgs, wgs);
   }
 
@@ -423,19 +591,25 @@ class GemmFactory {
   inline void eval(shared_mem scratch_acc, cl::sycl::nd_item<1> id) noexcept {
     auto scratch = scratch_acc.localAcc.get_pointer().get();
     using ScratchPointerType = decltype(scratch);
-    auto A = _A.getData().get_pointer().get();
-    auto B = _B.getData().get_pointer().get();
-    auto C = _C.getData().get_pointer().get();
+    // the views may start inside their buffer, e.g. on a block of a larger
+    // matrix, and their accessors always cover the whole buffer
+    auto A = _A.getData().get_pointer().get() + _A.getDisp();
+    auto B = _B.getData().get_pointer().get() + _B.getDisp();
+    auto C = _C.getData().get_pointer().get() + _C.getDisp();
     const auto wg_id = id.get_group(0);
     const auto item_id = id.get_local(0);
     const auto tile_size = tl_rows * tl_cols;
     const auto tile_id = wg_id / tile_size;
     const auto tile_local_id = wg_id % tile_size;
-    const auto tiles_per_col = (m - 1) / big_tile_rows + 1;
-    const auto tile_row = (tile_id % tiles_per_col) * tl_rows;
-    const auto tile_col = (tile_id / tiles_per_col) * tl_cols;
+    const IndexType tiles_per_col = (m - 1) / big_tile_rows + 1;
+    const IndexType tiles_per_row = (n - 1) / big_tile_cols + 1;
+    IndexType raster_row, raster_col;
+    raster_type::map(IndexType(tile_id), tiles_per_col, tiles_per_row,
+                     raster_row, raster_col);
+    const auto tile_row = raster_row * tl_rows;
+    const auto tile_col = raster_col * tl_cols;
     const auto wg_row = (tile_row + tile_local_id % tl_rows) * block_rows;
-    const auto wg_col = (tile_col + tile_local_id / tl_rows) * block_rows;
+    const auto wg_col = (tile_col + tile_local_id / tl_rows) * block_cols;
 
     /*  printf(" g_id %ld, tile_size %ld, tile_id %ld, tile_local_id %ld,
       tiles_per_col %ld, tile_row %ld, tile_col %ld, wg_row %ld, wg_col %ld\n",
@@ -461,15 +635,28 @@ class GemmFactory {
 
     const bool internal = m - wg_row >= block_rows && n - wg_col >= block_cols;
 
-    B = B +
-        (trans_b
-             ? (item_id / block_cols) * ldb + (wg_col + item_id % block_cols)
-             : item_id % cl_elems + (wg_col + item_id / cl_elems) * ldb);
+    // a packed A is a column-major block_rows x k_pad matrix per block-row
+    // and a packed B a sequence of column-major cl_elems x block_cols tiles
+    // per block-column, both zero-padded
+    const IndexType k_pad = ((k + cl_elems - 1) / cl_elems) * cl_elems;
+    const IndexType ld_a = packed_a ? block_rows : lda;
+    const IndexType ld_b = packed_b ? cl_elems : ldb;
+
+    B = B + (packed_b ? (wg_col / block_cols) * block_cols * k_pad +
+                            item_id % cl_elems +
+                            (item_id / cl_elems) * cl_elems
+                      : trans_b ? (item_id / block_cols) * ldb +
+                                      (wg_col + item_id % block_cols)
+                                : item_id % cl_elems +
+                                      (wg_col + item_id / cl_elems) * ldb);
     n = n - wg_col - (trans_b ? item_id % block_cols : item_id / cl_elems);
-    A = A +
-        (trans_a
-             ? (wg_row + item_id / cl_elems) * lda + (item_id % cl_elems)
-             : (wg_row + item_id % block_rows) + (item_id / block_rows) * lda);
+    A = A + (packed_a ? (wg_row / block_rows) * block_rows * k_pad +
+                            item_id % block_rows +
+                            (item_id / block_rows) * block_rows
+                      : trans_a ? (wg_row + item_id / cl_elems) * lda +
+                                      (item_id % cl_elems)
+                                : (wg_row + item_id % block_rows) +
+                                      (item_id / block_rows) * lda);
     m = m - wg_row - (trans_a ? item_id / cl_elems : item_id % block_rows);
 
     ScratchPointerType s1 =
@@ -484,14 +671,23 @@ class GemmFactory {
                  : item_id % block_rows + (item_id / block_rows) * ldsa);
     ScratchPointerType s4 = scratch + ofs + item_row;
 
+    // vector accesses need every row of a block, and so the leading
+    // dimension and the first element of the view, on a vector boundary
+    const bool vec_a = vector_a && ld_a % vector_size == 0 &&
+                       _A.getDisp() % vector_size == 0;
+    const bool vec_b = vector_b && ld_b % vector_size == 0 &&
+                       _B.getDisp() % vector_size == 0;
+    const bool vec_c = vector_c && ldc % vector_size == 0 &&
+                       _C.getDisp() % vector_size == 0;
+
     if (internal) {
       compute_panel_gemm<double_buffer, false, false>(
-          id, item_id, m, mc, n, nc, k, alpha, A, lda, B, ldb, beta, C, ldc, s1,
-          s2, s3, s4, reg_a, reg_b, reg_res);
+          id, item_id, m, mc, n, nc, k, alpha, A, ld_a, B, ld_b, beta, C, ldc,
+          scratch, s1, s2, s3, s4, reg_a, reg_b, reg_res, vec_a, vec_b, vec_c);
     } else {
       compute_panel_gemm<double_buffer, true, true>(
-          id, item_id, m, mc, n, nc, k, alpha, A, lda, B, ldb, beta, C, ldc, s1,
-          s2, s3, s4, reg_a, reg_b, reg_res);
+          id, item_id, m, mc, n, nc, k, alpha, A, ld_a, B, ld_b, beta, C, ldc,
+          scratch, s1, s2, s3, s4, reg_a, reg_b, reg_res, false, false, false);
     }
   }
 
@@ -508,6 +704,10 @@ class GemmFactory {
    *                        out-of-bound
    * @tparam check_n_limit  iff true, check if no indexes of C are
    *                        out-of-bound
+   *
+   * @param vec_a  iff true, full blocks of A are loaded with vector accesses
+   * @param vec_b  iff true, full blocks of B are loaded with vector accesses
+   * @param vec_c  iff true, C is updated with vector accesses
    */
   template <bool double_buffer, bool check_m_limit, bool check_n_limit,
             typename InputPointerType, typename OutputPointerType,
@@ -516,29 +716,60 @@ class GemmFactory {
       cl::sycl::nd_item<1> id, IndexType item_id, IndexType m, IndexType mc,
       IndexType n, IndexType nc, IndexType k, T alpha, InputPointerType A,
       IndexType lda, InputPointerType B, IndexType ldb, T beta,
-      OutputPointerType C, IndexType ldc, ScratchPointerType s1,
-      ScratchPointerType s2, ScratchPointerType s3, ScratchPointerType s4,
-      T (&reg_a)[item_rows], T &reg_b,
-      T (&reg_res)[item_rows][item_cols]) noexcept {
+      OutputPointerType C, IndexType ldc, ScratchPointerType scratch,
+      ScratchPointerType s1, ScratchPointerType s2, ScratchPointerType s3,
+      ScratchPointerType s4, T (&reg_a)[item_rows], T &reg_b,
+      T (&reg_res)[item_rows][item_cols], bool vec_a, bool vec_b,
+      bool vec_c) noexcept {
     IndexType ofs = 1;
 
-    while (k >= cl_elems) {
-      extract_input_blocks<check_m_limit, check_n_limit, false>(
-          item_id, m, n, k, A, lda, B, ldb, s1, s3);
-      id.barrier(cl::sycl::access::fence_space::local_space);
-      compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
-      A = A + cl_elems * (trans_a ? 1 : lda);
-      B = B + cl_elems * (trans_b ? ldb : 1);
-      k -= cl_elems;
-      sync_smem<double_buffer, block_cols * ldsb, block_cols * ldsb,
-                ldsa * cl_elems, ldsa * cl_elems>(id, ofs, s1, s2, s3, s4);
+    if (pipeline) {
+      // the blocks of the next iteration are in flight while the current
+      // ones are multiplied
+      T reg_pa[prefetch_a_size];
+      T reg_pb[prefetch_b_size];
+      prefetch_input_blocks<check_m_limit, check_n_limit>(
+          item_id, m, n, k, A, lda, B, ldb, reg_pa, reg_pb);
+      while (k > 0) {
+        commit_input_blocks(item_id, s1, s3, reg_pa, reg_pb);
+        id.barrier(cl::sycl::access::fence_space::local_space);
+        A = A + cl_elems * (trans_a ? 1 : lda);
+        B = B + (packed_b ? cl_elems * block_cols
+                          : cl_elems * (trans_b ? ldb : 1));
+        k = k > cl_elems ? k - cl_elems : 0;
+        if (k > 0) {
+          prefetch_input_blocks<check_m_limit, check_n_limit>(
+              item_id, m, n, k, A, lda, B, ldb, reg_pa, reg_pb);
+        }
+        compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
+        sync_smem<double_buffer, block_cols * ldsb, block_cols * ldsb,
+                  ldsa * cl_elems, ldsa * cl_elems>(id, ofs, s1, s2, s3, s4);
+      }
+    } else {
+      while (k >= cl_elems) {
+        extract_input_blocks<check_m_limit, check_n_limit, false>(
+            item_id, m, n, k, A, lda, B, ldb, s1, s3, vec_a, vec_b);
+        id.barrier(cl::sycl::access::fence_space::local_space);
+        compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
+        A = A + cl_elems * (trans_a ? 1 : lda);
+        B = B + (packed_b ? cl_elems * block_cols
+                          : cl_elems * (trans_b ? ldb : 1));
+        k -= cl_elems;
+        sync_smem<double_buffer, block_cols * ldsb, block_cols * ldsb,
+                  ldsa * cl_elems, ldsa * cl_elems>(id, ofs, s1, s2, s3, s4);
+      }
+
+      if (k > 0) {
+        extract_input_blocks<check_m_limit, check_n_limit, true>(
+            item_id, m, n, k, A, lda, B, ldb, s1, s3);
+        id.barrier(cl::sycl::access::fence_space::local_space);
+        compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
+      }
     }
 
-    if (k > 0) {
-      extract_input_blocks<check_m_limit, check_n_limit, true>(
-          item_id, m, n, k, A, lda, B, ldb, s1, s3);
-      id.barrier(cl::sycl::access::fence_space::local_space);
-      compute_block_gemm(s2, s4, reg_a, reg_b, reg_res);
+    if (vector_c && !check_m_limit && !check_n_limit && vec_c) {
+      store_output_block(id, item_id, alpha, beta, C, ldc, scratch, reg_res);
+      return;
     }
 
 #pragma unroll
@@ -555,6 +786,57 @@ class GemmFactory {
     }
   }
 
+  /*!
+   * @brief Update a full block of C with vector accesses.
+   *
+   * The elements of a work item are wg_rows apart in each of its columns, so
+   * they are first gathered in scratchpad memory, one block_rows x wg_cols
+   * slice of C at a time (the i-th column of every item), and then read back
+   * and merged with C a vector at a time.
+   *
+   * This is a collective operation between all items in a work-group.
+   *
+   * @param C  pointer to C with the item-dependent offset of
+   *           GemmFactory::eval()
+   */
+  template <typename OutputPointerType, typename ScratchPointerType>
+  static inline void store_output_block(
+      cl::sycl::nd_item<1> id, IndexType item_id, T alpha, T beta,
+      OutputPointerType C, IndexType ldc, ScratchPointerType scratch,
+      T (&reg_res)[item_rows][item_cols]) noexcept {
+    using vector_t = cl::sycl::vec<T, vector_size>;
+    using global_ptr_t =
+        cl::sycl::multi_ptr<T, cl::sycl::access::address_space::global_space>;
+    using local_ptr_t =
+        cl::sycl::multi_ptr<T, cl::sycl::access::address_space::local_space>;
+    constexpr IndexType bs = block_rows * wg_cols;
+    const IndexType item_row = item_id % wg_rows;
+    const IndexType item_col = item_id / wg_rows;
+    C = C - item_row - item_col * item_cols * ldc;
+    for (IndexType i = 0; i < item_cols; ++i) {
+      // the previous slice, or the last blocks of A and B, are still read
+      id.barrier(cl::sycl::access::fence_space::local_space);
+#pragma unroll
+      for (IndexType j = 0; j < item_rows; ++j) {
+        scratch[item_row + j * wg_rows + item_col * block_rows] =
+            reg_res[j][i];
+      }
+      id.barrier(cl::sycl::access::fence_space::local_space);
+#pragma unroll
+      for (IndexType v = 0; v < (bs / vector_size - 1) / wg_size + 1; ++v) {
+        const IndexType e = (item_id + v * wg_size) * vector_size;
+        if (!do_check<((bs / vector_size) % wg_size != 0)>(e < bs)) continue;
+        const IndexType r = e % block_rows;
+        const IndexType c = (e / block_rows) * item_cols + i;
+        auto out = C + r + c * ldc;
+        vector_t res, acc;
+        res.load(0, local_ptr_t(scratch + e));
+        acc.load(0, global_ptr_t(out));
+        (res * alpha + acc * beta).store(0, global_ptr_t(out));
+      }
+    }
+  }
+
   /*!
    * @brief Extract a block of A, and a conformant block of B.
    *
@@ -562,20 +844,159 @@ class GemmFactory {
    */
   template <bool check_m_limit, bool check_n_limit, bool check_k_limit,
             typename InputPointerType, typename ScratchPointerType>
-  static inline void extract_input_blocks(IndexType item_id, IndexType m,
-                                          IndexType n, IndexType k,
-                                          InputPointerType A, IndexType lda,
-                                          InputPointerType B, IndexType ldb,
-                                          ScratchPointerType sB,
-                                          ScratchPointerType sA) noexcept {
-    extract_block<check_m_limit, check_k_limit, trans_a, block_rows, cl_elems,
-                  ldsa>(
-        item_id, A, lda, sA, [&](IndexType ir, IndexType cr) { return cr < m; },
+  static inline void extract_input_blocks(
+      IndexType item_id, IndexType m, IndexType n, IndexType k,
+      InputPointerType A, IndexType lda, InputPointerType B, IndexType ldb,
+      ScratchPointerType sB, ScratchPointerType sA, bool vec_a = false,
+      bool vec_b = false) noexcept {
+    constexpr bool full = !check_m_limit && !check_n_limit && !check_k_limit;
+    if (vector_a && full && vec_a) {
+      extract_block_vec<block_rows, cl_elems, ldsa>(item_id, A, lda, sA);
+    } else {
+      extract_block<check_m_limit, check_k_limit, trans_a, block_rows,
+                    cl_elems, ldsa>(
+          item_id, A, lda, sA,
+          [&](IndexType ir, IndexType cr) { return cr < m; },
+          [&](IndexType ic, IndexType cc) { return cc < k - ic; });
+    }
+    if (vector_b && full && vec_b) {
+      extract_block_vec<cl_elems, block_cols, ldsb>(item_id, B, ldb, sB);
+    } else {
+      extract_block<check_k_limit, check_n_limit, trans_b, cl_elems,
+                    block_cols, ldsb>(
+          item_id, B, ldb, sB,
+          [&](IndexType ir, IndexType cr) { return cr < k - ir; },
+          [&](IndexType ic, IndexType cc) { return cc < n; });
+    }
+  }
+
+  /*!
+   * @brief Copy a full, non-transposed block of a matrix from global to
+   *        shared memory vector_size elements at a time.
+   *
+   * Takes the same item-dependent pointers as GemmFactory::extract_block(),
+   * the rows, leading dimensions and pointers have to be vector aligned.
+   */
+  template <IndexType rows, IndexType cols, IndexType lds,
+            typename InputPointerType, typename ScratchPointerType>
+  static inline void extract_block_vec(IndexType item_id, InputPointerType ptr,
+                                       IndexType ld,
+                                       ScratchPointerType scratch) {
+    using vector_t = cl::sycl::vec<T, vector_size>;
+    using global_ptr_t =
+        cl::sycl::multi_ptr<T, cl::sycl::access::address_space::global_space>;
+    using local_ptr_t =
+        cl::sycl::multi_ptr<T, cl::sycl::access::address_space::local_space>;
+    constexpr IndexType bs = rows * cols;
+    // back to the first element of the block
+    ptr = ptr - (item_id % rows + (item_id / rows) * ld);
+    scratch = scratch - (item_id % rows + (item_id / rows) * lds);
+#pragma unroll
+    for (IndexType i = 0; i < (bs / vector_size - 1) / wg_size + 1; ++i) {
+      const IndexType e = (item_id + i * wg_size) * vector_size;
+      if (!do_check<((bs / vector_size) % wg_size != 0)>(e < bs)) continue;
+      const IndexType r = e % rows;
+      const IndexType c = e / rows;
+      vector_t v;
+      v.load(0, global_ptr_t(ptr + r + c * ld));
+      v.store(0, local_ptr_t(scratch + r + c * lds));
+    }
+  }
+
+  /*!
+   * @brief Load the next block of A, and a conformant block of B, into
+   *        registers, checking the k limit only on the last partial block.
+   *
+   * @see GemmFactory::load_block()
+   */
+  template <bool check_m_limit, bool check_n_limit, typename InputPointerType>
+  static inline void prefetch_input_blocks(
+      IndexType item_id, IndexType m, IndexType n, IndexType k,
+      InputPointerType A, IndexType lda, InputPointerType B, IndexType ldb,
+      T (&reg_pa)[prefetch_a_size], T (&reg_pb)[prefetch_b_size]) noexcept {
+    if (k >= cl_elems) {
+      load_input_blocks<check_m_limit, check_n_limit, false>(
+          item_id, m, n, k, A, lda, B, ldb, reg_pa, reg_pb);
+    } else {
+      load_input_blocks<check_m_limit, check_n_limit, true>(
+          item_id, m, n, k, A, lda, B, ldb, reg_pa, reg_pb);
+    }
+  }
+
+  template <bool check_m_limit, bool check_n_limit, bool check_k_limit,
+            typename InputPointerType>
+  static inline void load_input_blocks(
+      IndexType item_id, IndexType m, IndexType n, IndexType k,
+      InputPointerType A, IndexType lda, InputPointerType B, IndexType ldb,
+      T (&reg_pa)[prefetch_a_size], T (&reg_pb)[prefetch_b_size]) noexcept {
+    load_block<check_m_limit, check_k_limit, trans_a, block_rows, cl_elems>(
+        item_id, A, lda, reg_pa,
+        [&](IndexType ir, IndexType cr) { return cr < m; },
         [&](IndexType ic, IndexType cc) { return cc < k - ic; });
-    extract_block<check_k_limit, check_n_limit, trans_b, cl_elems, block_cols,
-                  ldsb>(item_id, B, ldb, sB,
-                        [&](IndexType ir, IndexType cr) { return cr < k - ir; },
-                        [&](IndexType ic, IndexType cc) { return cc < n; });
+    load_block<check_k_limit, check_n_limit, trans_b, cl_elems, block_cols>(
+        item_id, B, ldb, reg_pb,
+        [&](IndexType ir, IndexType cr) { return cr < k - ir; },
+        [&](IndexType ic, IndexType cc) { return cc < n; });
+  }
+
+  /*!
+   * @brief Store the prefetched blocks of A and B to shared memory.
+   *
+   * @see GemmFactory::store_block()
+   */
+  template <typename ScratchPointerType>
+  static inline void commit_input_blocks(
+      IndexType item_id, ScratchPointerType sB, ScratchPointerType sA,
+      T (&reg_pa)[prefetch_a_size], T (&reg_pb)[prefetch_b_size]) noexcept {
+    store_block<trans_a, block_rows, cl_elems, ldsa>(item_id, sA, reg_pa);
+    store_block<trans_b, cl_elems, block_cols, ldsb>(item_id, sB, reg_pb);
+  }
+
+  /*!
+   * @brief First half of GemmFactory::extract_block(): load the elements of
+   *        a block that belong to this item into registers.
+   *
+   * @param reg  registers that receive the elements, in the order in which
+   *             GemmFactory::store_block() writes them
+   */
+  template <bool check_row_limit, bool check_col_limit, bool trans,
+            IndexType rows, IndexType cols, IndexType regs,
+            typename InputPointerType, typename RowPredicate,
+            typename ColPredicate>
+  static inline void load_block(IndexType item_id, InputPointerType ptr,
+                                IndexType ld, T (&reg)[regs],
+                                RowPredicate in_row, ColPredicate in_col) {
+    const IndexType bs = rows * cols;
+#pragma unroll
+    for (IndexType i = 0; i < regs; ++i) {
+      if (!do_check<((bs % wg_size) != 0)>(item_id + i * wg_size < bs))
+        continue;
+      const IndexType ofs = i * (wg_size / (trans ? cols : rows));
+      const bool in_range =
+          trans ? do_check<check_row_limit>(in_row(item_id / cols, ofs)) &&
+                      do_check<check_col_limit>(in_col(item_id % cols, 0))
+                : do_check<check_row_limit>(in_row(item_id % rows, 0)) &&
+                      do_check<check_col_limit>(in_col(item_id / rows, ofs));
+      reg[i] = in_range ? ptr[ofs * ld] : T(0);
+    }
+  }
+
+  /*!
+   * @brief Second half of GemmFactory::extract_block(): store the registers
+   *        filled by GemmFactory::load_block() to shared memory.
+   */
+  template <bool trans, IndexType rows, IndexType cols, IndexType lds,
+            IndexType regs, typename ScratchPointerType>
+  static inline void store_block(IndexType item_id, ScratchPointerType scratch,
+                                 T (&reg)[regs]) {
+    const IndexType bs = rows * cols;
+#pragma unroll
+    for (IndexType i = 0; i < regs; ++i) {
+      if (!do_check<((bs % wg_size) != 0)>(item_id + i * wg_size < bs))
+        continue;
+      scratch[trans ? i * (wg_size / cols) : i * (wg_size / rows) * lds] =
+          reg[i];
+    }
   }
 
   /*!
@@ -723,15 +1144,247 @@ class GemmFactory {
   }
 };
 
+/*!
+ * @brief GemmPack copies an operand of GemmFactory into the order in which
+ *        GemmFactory stages it into scratchpad memory, so that a GemmFactory
+ *        with PackedA or PackedB loads it with contiguous reads only.
+ *
+ * One work item writes one element of the packed operand, elements outside
+ * of the operand are zero. Panels of PanelSize rows of op(A) (or columns of
+ * op(B)) follow each other. With k_pad the depth rounded up to a multiple of
+ * ChunkSize, each panel is:
+ *  - for A, a column-major PanelSize x k_pad matrix,
+ *  - for B, k_pad / ChunkSize column-major ChunkSize x PanelSize tiles.
+ *
+ * @tparam PackB  iff true, pack a right hand side operand, otherwise a left
+ *                hand side one
+ * @tparam Trans  iff true, the operand is stored transposed
+ * @tparam PanelSize  block_rows (for A) or block_cols (for B) of the
+ *                    GemmFactory that will read the operand
+ * @tparam ChunkSize  cl_elems of the GemmFactory that will read the operand
+ */
+template <typename RHS, bool PackB, bool Trans, int PanelSize, int ChunkSize>
+class GemmPack {
+ public:
+  using value_type = typename RHS::value_type;
+  using IndexType = typename RHS::IndexType;
+  RHS _X;
+  RHS _P;
+  IndexType rows;
+  IndexType cols;
+  IndexType ldx;
+  IndexType k_pad;
+
+  inline GemmPack(RHS X, RHS P)
+      : _X(X),
+        _P(P),
+        rows(_X.getSizeR()),
+        cols(_X.getSizeC()),
+        ldx(_X.getSizeL()),
+        k_pad((((PackB ? rows : cols) + ChunkSize - 1) / ChunkSize) *
+              ChunkSize) {}
+
+  /*!
+   * @brief Number of elements of the packed operand.
+   */
+  static inline IndexType packed_size(IndexType rows, IndexType cols) {
+    const IndexType depth = PackB ? rows : cols;
+    const IndexType width = PackB ? cols : rows;
+    return ((width + PanelSize - 1) / PanelSize) * PanelSize *
+           (((depth + ChunkSize - 1) / ChunkSize) * ChunkSize);
+  }
+
+  inline IndexType getSize() { return packed_size(rows, cols); }
+
+  inline void eval(cl::sycl::nd_item<1> id) noexcept {
+    auto X = _X.getData().get_pointer().get() + _X.getDisp();
+    auto P = _P.getData().get_pointer().get() + _P.getDisp();
+    const IndexType idx = id.get_global(0);
+    const IndexType panel = idx / (PanelSize * k_pad);
+    const IndexType in_panel = idx % (PanelSize * k_pad);
+    IndexType row, col;
+    if (PackB) {
+      const IndexType in_tile = in_panel % (ChunkSize * PanelSize);
+      row = (in_panel / (ChunkSize * PanelSize)) * ChunkSize +
+            in_tile % ChunkSize;
+      col = panel * PanelSize + in_tile / ChunkSize;
+    } else {
+      row = panel * PanelSize + in_panel % PanelSize;
+      col = in_panel / PanelSize;
+    }
+    P[idx] = (row < rows && col < cols)
+                 ? X[Trans ? col + row * ldx : row + col * ldx]
+                 : value_type(0);
+  }
+};
+
+/*!
+ * @brief This factory generates quantized gemm implementations,
+ *        C = requantize(scale * (op(A) - a_zero) * (op(B) - b_zero)) + c_zero
+ *        with 8 bit A, B and C.
+ *
+ * The products are accumulated in 32 bit integers, each work item computing
+ * ItemRows consecutive elements of a column of C in reg_res, so that every
+ * element of B it loads is used ItemRows times. The epilogue scales the
+ * accumulators with the per-tensor scale, or the per-channel scale of their
+ * column of C, rounds them to the nearest integer, adds the zero point of C
+ * and saturates them to the range of its type. A, B and C can be int8_t or
+ * uint8_t independently, and the zero points are subtracted as the elements
+ * are loaded, so that asymmetric quantization costs no extra pass.
+ *
+ * @tparam WgSize  the number of items in a work group
+ * @tparam ItemRows  the number of rows of C computed by each item
+ * @tparam TransA  iff true, A will be transposed on the fly
+ * @tparam TransB  iff true, B will be transposed on the fly
+ * @tparam PerChannel  iff true, S holds one scale per column of C, otherwise
+ *                     a single scale
+ */
+template <typename RHS0, typename RHS1, typename RHS2, typename RHS3,
+          int WgSize, int ItemRows, bool TransA, bool TransB, bool PerChannel>
+class QuantizedGemmFactory {
+ public:
+  using value_type = int32_t;
+  using IndexType = typename RHS0::IndexType;
+  using output_type = typename RHS2::value_type;
+  using scale_type = typename RHS3::value_type;
+  static constexpr int version = 2;
+  static constexpr int wg_size = WgSize;
+  static constexpr int item_rows = ItemRows;
+  static constexpr bool trans_a = TransA;
+  static constexpr bool trans_b = TransB;
+  static constexpr bool per_channel = PerChannel;
+  static constexpr int scratch_size = 0;
+  RHS0 _A;
+  RHS1 _B;
+  RHS2 _C;
+  RHS3 _S;
+  value_type a_zero;
+  value_type b_zero;
+  value_type c_zero;
+  IndexType m;
+  IndexType n;
+  IndexType k;
+  IndexType lda;
+  IndexType ldb;
+  IndexType ldc;
+
+  inline QuantizedGemmFactory(RHS0 A, RHS1 B, RHS2 C, RHS3 S,
+                              value_type a_zero, value_type b_zero,
+                              value_type c_zero)
+      : _A(A),
+        _B(B),
+        _C(C),
+        _S(S),
+        a_zero(a_zero),
+        b_zero(b_zero),
+        c_zero(c_zero),
+        m(_A.getSizeR()),
+        n(_B.getSizeC()),
+        k(_A.getSizeC()),
+        lda(_A.getSizeL()),
+        ldb(_B.getSizeL()),
+        ldc(_C.getSizeL()) {}
+
+  static inline std::string get_type_string() noexcept {
+    return std::string("QuantizedGemmFactory<") + std::to_string(wg_size) +
+           ", " + std::to_string(item_rows) + ", " +
+           type_string<typename RHS0::value_type>::get_value() + ", " +
+           type_string<typename RHS1::value_type>::get_value() + ", " +
+           type_string<output_type>::get_value() + ", " +
+           (per_channel ? "per_channel" : "per_tensor") + ">";
+  }
+
+  static inline IndexType get_items(IndexType m, IndexType n) noexcept {
+    return ((m - 1) / item_rows + 1) * n;
+  }
+
+  static inline cl::sycl::nd_range<1> get_nd_range(IndexType m,
+                                                   IndexType n) noexcept {
+    const cl::sycl::range<1> nwg((get_items(m, n) - 1) / wg_size + 1);
+    const cl::sycl::range<1> wgs(wg_size);
+    return cl::sycl::nd_range<1>(nwg * wgs, wgs);
+  }
+
+  inline IndexType getSize() { return get_items(m, n); }
+
+  /*!
+   * @brief Rounds scale * acc to the nearest integer, ties away from zero,
+   *        offsets it by zero and saturates it to the range of output_type.
+   */
+  static inline output_type requantize(value_type acc, scale_type scale,
+                                       value_type zero) noexcept {
+    constexpr scale_type lo = std::numeric_limits<output_type>::min();
+    constexpr scale_type hi = std::numeric_limits<output_type>::max();
+    scale_type q = scale * static_cast<scale_type>(acc) +
+                   static_cast<scale_type>(zero);
+    q = q < lo ? lo : (q > hi ? hi : q);
+    const scale_type half = q < 0 ? scale_type(-0.5) : scale_type(0.5);
+    return static_cast<output_type>(static_cast<value_type>(q + half));
+  }
+
+  inline void eval(cl::sycl::nd_item<1> id) noexcept {
+    auto A = _A.getData().get_pointer().get() + _A.getDisp();
+    auto B = _B.getData().get_pointer().get() + _B.getDisp();
+    auto C = _C.getData().get_pointer().get() + _C.getDisp();
+    auto S = _S.getData().get_pointer().get() + _S.getDisp();
+    const IndexType item_id = id.get_global(0);
+    const IndexType row_blocks = (m - 1) / item_rows + 1;
+    if (item_id >= row_blocks * n) {
+      return;
+    }
+
+    const IndexType row = (item_id % row_blocks) * item_rows;
+    const IndexType col = item_id / row_blocks;
+    const IndexType a_row_stride = trans_a ? lda : 1;
+
+    A = A + row * a_row_stride;
+    B = B + col * (trans_b ? 1 : ldb);
+    C = C + row + col * ldc;
+
+    value_type reg_res[item_rows] = {};
+
+    for (IndexType l = 0; l < k; ++l) {
+      const value_type reg_b = static_cast<value_type>(B[0]) - b_zero;
+#pragma unroll
+      for (int i = 0; i < item_rows; ++i) {
+        if (row + i < m) {
+          reg_res[i] +=
+              (static_cast<value_type>(A[i * a_row_stride]) - a_zero) * reg_b;
+        }
+      }
+      A = A + (trans_a ? 1 : lda);
+      B = B + (trans_b ? ldb : 1);
+    }
+
+    const scale_type scale = S[per_channel ? col : 0];
+#pragma unroll
+    for (int i = 0; i < item_rows; ++i) {
+      if (row + i < m) {
+        C[i] = requantize(reg_res[i], scale, c_zero);
+      }
+    }
+  }
+};
+
 template <bool DoubleBuffer, bool ConflictA, bool ConflictB, int ClSize,
-          typename TileType, bool TransA, bool TransB, typename RHS1,
-          typename RHS2, typename T>
+          typename TileType, bool TransA, bool TransB, bool PackedA = false,
+          bool PackedB = false, bool Pipeline = false, int VectorSize = 1,
+          typename Raster = ColumnRaster, typename RHS1, typename RHS2,
+          typename T>
 inline GemmFactory<RHS1, RHS2, DoubleBuffer, ConflictA, ConflictB, ClSize,
-                   TileType, TransA, TransB, T>
+                   TileType, TransA, TransB, T, PackedA, PackedB, Pipeline,
+                   VectorSize, Raster>
 make_gemm(RHS1 buffer_a, RHS1 buffer_b, RHS2 buffer_c, T alpha, T beta) {
   return GemmFactory<RHS1, RHS2, DoubleBuffer, ConflictA, ConflictB, ClSize,
-                     TileType, TransA, TransB, T>(buffer_a, buffer_b, buffer_c,
-                                                  alpha, beta);
+                     TileType, TransA, TransB, T, PackedA, PackedB, Pipeline,
+                     VectorSize, Raster>(
+      buffer_a, buffer_b, buffer_c, alpha, beta);
+}
+
+template <bool PackB, bool Trans, int PanelSize, int ChunkSize, typename RHS>
+inline GemmPack<RHS, PackB, Trans, PanelSize, ChunkSize> make_gemm_pack(
+    RHS buffer_x, RHS buffer_p) {
+  return GemmPack<RHS, PackB, Trans, PanelSize, ChunkSize>(buffer_x, buffer_p);
 }
 
 template <int WgSize, bool TransA, bool TransB, typename RHS1, typename RHS2,
@@ -743,6 +1396,18 @@ make_gemm_no_local_mem(RHS1 buffer_a, RHS1 buffer_b, RHS2 buffer_c, T alpha,
       buffer_a, buffer_b, buffer_c, alpha, beta);
 }
 
+template <int WgSize, int ItemRows, bool TransA, bool TransB, bool PerChannel,
+          typename RHS0, typename RHS1, typename RHS2, typename RHS3>
+inline QuantizedGemmFactory<RHS0, RHS1, RHS2, RHS3, WgSize, ItemRows, TransA,
+                            TransB, PerChannel>
+make_quantized_gemm(RHS0 buffer_a, RHS1 buffer_b, RHS2 buffer_c,
+                    RHS3 buffer_s, int32_t a_zero, int32_t b_zero,
+                    int32_t c_zero) {
+  return QuantizedGemmFactory<RHS0, RHS1, RHS2, RHS3, WgSize, ItemRows, TransA,
+                              TransB, PerChannel>(
+      buffer_a, buffer_b, buffer_c, buffer_s, a_zero, b_zero, c_zero);
+}
+
 }  // namespace blas
 
 #endif  // BLAS3_TREES_GEMM_HPP
@@ -152,14 +152,20 @@ SYCLBLAS_DEFINE_CONSTANT(
     std::complex<double>, const_val::min,
     (std::complex<double>(std::numeric_limits<double>::min(),
                           std::numeric_limits<double>::min())))
+SYCLBLAS_DEFINE_CONSTANT(
+    IndexValueTuple<float>, const_val::imax,
+    (IndexValueTuple<float>(std::numeric_limits<size_t>::max(),
+                            std::numeric_limits<float>::max())))
+SYCLBLAS_DEFINE_CONSTANT(IndexValueTuple<float>, const_val::imin,
+                         (IndexValueTuple<float>(
+                             std::numeric_limits<size_t>::max(), 0.0f)))
 SYCLBLAS_DEFINE_CONSTANT(
     IndexValueTuple<double>, const_val::imax,
     (IndexValueTuple<double>(std::numeric_limits<size_t>::max(),
                              std::numeric_limits<double>::max())))
-SYCLBLAS_DEFINE_CONSTANT(
-    IndexValueTuple<double>, const_val::imin,
-    (IndexValueTuple<double>(std::numeric_limits<size_t>::max(),
-                             std::numeric_limits<double>::min())))
+SYCLBLAS_DEFINE_CONSTANT(IndexValueTuple<double>, const_val::imin,
+                         (IndexValueTuple<double>(
+                             std::numeric_limits<size_t>::max(), 0.0)))
 }  // namespace blas
 
 /*!
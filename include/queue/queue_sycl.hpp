@@ -26,6 +26,8 @@
 #define QUEUE_SYCL_HPP
 
 #include <CL/sycl.hpp>
+#include <cstring>
+#include <map>
 #include <queue/pointer_mapper.hpp>
 #include <queue/queue_base.hpp>
 #include <stdexcept>
@@ -43,6 +45,8 @@ class Queue_Interface<SYCL> {
   // lock is used to make sure that the operation is safe when we are running it
   // in a multi-threaded environment.
   mutable std::mutex mutex_;
+  // host memory behind the pointers of register_host_memory
+  std::map<void *, void *> host_memory_;
 
  public:
   enum device_type { UNSUPPORTED_DEVICE, INTELGPU, AMDGPU };
@@ -66,6 +70,14 @@ class Queue_Interface<SYCL> {
     }
     throw std::runtime_error("couldn't find device");
   }
+  /*
+  @brief true when the device shares the memory of the host, i.e. when the
+  buffers of register_host_memory are used in place
+  */
+  inline bool is_host_unified_memory() const {
+    return q_.get_device()
+        .template get_info<cl::sycl::info::device::host_unified_memory>();
+  }
   inline bool has_local_memory() const {
     return (q_.get_device()
                 .template get_info<cl::sycl::info::device::local_mem_type>() ==
@@ -120,10 +132,23 @@ class Queue_Interface<SYCL> {
   */
   template <typename T>
   cl::sycl::event copy_to_device(T *src, T *dst, size_t size) {
+    auto event = copy_to_device_async(src, dst, size);
+    q_.wait();
+    return event;
+  }
+  /*  @brief Enqueues a copy to the device and returns without waiting for
+      it, the kernels that use dst are ordered after it by the runtime.
+      @param src is the host pointer we want to copy from, it has to stay
+      valid and unchanged until the returned event completes.
+      @param dst is the device pointer we want to copy to.
+      @param size is the number of elements to be copied
+  */
+  template <typename T>
+  cl::sycl::event copy_to_device_async(T *src, T *dst, size_t size) {
     std::lock_guard<std::mutex> lock(mutex_);
     auto buffer = pointer_mapper.get_buffer(static_cast<void *>(dst));
     auto offset = pointer_mapper.get_offset(static_cast<void *>(dst));
-    auto event = q_.submit([&](cl::sycl::handler &cgh) {
+    return q_.submit([&](cl::sycl::handler &cgh) {
       auto write_acc =
           buffer.template get_access<cl::sycl::access::mode::write,
                                      cl::sycl::access::target::global_buffer>(
@@ -133,8 +158,6 @@ class Queue_Interface<SYCL> {
           static_cast<generic_buffer_data_type *>(static_cast<void *>(src)),
           write_acc);
     });
-    q_.wait();
-    return event;
   }
   /*  @brief Copying the data back to device
       @tparam T is the type of the data
@@ -162,6 +185,84 @@ class Queue_Interface<SYCL> {
     q_.wait();
     return event;
   }
+  /*  @brief Enqueues a copy back to the host after the kernels that write
+      src, and returns without waiting for it.
+      @param src is the device pointer we want to copy from.
+      @param dst is the host pointer we want to copy to, it can only be read
+      once the returned event completes.
+      @param size is the number of elements to be copied
+  */
+  template <typename T>
+  cl::sycl::event copy_to_host_async(T *src, T *dst, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto buffer = pointer_mapper.get_buffer(static_cast<void *>(src));
+    auto offset = pointer_mapper.get_offset(static_cast<void *>(src));
+    return q_.submit([&](cl::sycl::handler &cgh) {
+      auto read_acc =
+          buffer.template get_access<cl::sycl::access::mode::read,
+                                     cl::sycl::access::target::global_buffer>(
+              cgh, cl::sycl::range<1>(size * sizeof(T)),
+              cl::sycl::id<1>(offset));
+      cgh.copy(read_acc, static_cast<generic_buffer_data_type *>(
+                             static_cast<void *>(dst)));
+    });
+  }
+  /*  @brief Registers host memory, returning a pointer that the routines
+      take like one from allocate(). Its buffer is built over the host memory
+      with use_host_ptr, which devices with unified memory use in place.
+      @param host is the host memory, it has to stay valid until
+      unregister_host_memory, and be accessed only after synchronize.
+      @param num_elements is the number of elements of host
+  */
+  template <typename T>
+  inline T *register_host_memory(T *host, size_t num_elements) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    using buffer_t = cl::sycl::buffer<
+        generic_buffer_data_type, 1,
+        cl::sycl::codeplay::buffer_allocator_default_t>;
+    buffer_t buffer(
+        static_cast<generic_buffer_data_type *>(static_cast<void *>(host)),
+        cl::sycl::range<1>(num_elements * sizeof(T)),
+        {cl::sycl::property::buffer::use_host_ptr()});
+    void *ptr = pointer_mapper.add_pointer(std::move(buffer));
+    host_memory_[ptr] = static_cast<void *>(host);
+    return static_cast<T *>(ptr);
+  }
+  /*  @brief Waits for the kernels using registered memory and makes the host
+      memory up to date, the kernels submitted after it see the changes made
+      to the host memory in between.
+      @param ptr is a pointer returned by register_host_memory
+  */
+  template <typename T>
+  inline void synchronize(T *ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto host = host_memory_.find(static_cast<void *>(ptr));
+    if (host == host_memory_.end()) {
+      throw std::invalid_argument("the pointer is not registered host memory");
+    }
+    auto buffer = pointer_mapper.get_buffer(static_cast<void *>(ptr));
+    // the host accessor is the host memory itself with use_host_ptr, the
+    // copy is for implementations that do not honour it
+    auto acc = buffer.template get_access<cl::sycl::access::mode::read_write>();
+    void *data = static_cast<void *>(acc.get_pointer());
+    if (data != host->second) {
+      std::memcpy(host->second, data, buffer.get_size());
+    }
+  }
+  /*  @brief Synchronizes registered memory and forgets it, the host memory
+      can be released afterwards.
+      @param ptr is a pointer returned by register_host_memory
+  */
+  template <typename T>
+  inline void unregister_host_memory(T *ptr) {
+    synchronize(ptr);
+    std::lock_guard<std::mutex> lock(mutex_);
+    host_memory_.erase(static_cast<void *>(ptr));
+    // the node is dropped rather than recycled, so that its buffer and the
+    // reference it holds to the host memory are released now
+    cl::sycl::codeplay::SYCLfree<false>(static_cast<void *>(ptr),
+                                        pointer_mapper);
+  }
 };  // class Queue_Interface
 }  // namespace blas
 #endif  // QUEUE_SYCL_HPP
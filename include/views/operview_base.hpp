@@ -505,6 +505,338 @@ struct matrix_view {
   }
 };
 
+/*!
+@brief Template struct for a sparse matrix in compressed sparse row (CSR)
+format. It is built over three vector views, which the expression trees
+convert like any other view.
+@tparam RowPtrT View of the row pointers, zero based, with one more entry than
+rows. Row i has the nonzeros from RowPtr[i] to RowPtr[i + 1].
+@tparam ColIdxT View of the column indices of the nonzeros.
+@tparam ValT View of the values of the nonzeros.
+*/
+template <class RowPtrT_, class ColIdxT_, class ValT_>
+struct csr_view {
+  using RowPtrT = RowPtrT_;
+  using ColIdxT = ColIdxT_;
+  using ValT = ValT_;
+  using IndexType = typename ValT::IndexType;
+  using value_type = typename ValT::value_type;
+  RowPtrT rowPtr_;
+  ColIdxT colIdx_;
+  ValT val_;
+  IndexType sizeC_;  // number of columns
+
+  /*!
+   * @brief Constructs a CSR view on the row pointers, the column indices and
+   * the values.
+   * @param sizeC Number of columns.
+   */
+  csr_view(RowPtrT rowPtr, ColIdxT colIdx, ValT val, IndexType sizeC)
+      : rowPtr_(rowPtr), colIdx_(colIdx), val_(val), sizeC_(sizeC) {}
+
+  /*!
+   * @brief Returns the number of rows.
+   */
+  IndexType getSizeR() { return rowPtr_.getSize() - 1; }
+
+  /*!
+   * @brief Returns the number of columns.
+   */
+  IndexType getSizeC() { return sizeC_; }
+
+  /*!
+   * @brief Returns the number of nonzeros.
+   */
+  IndexType getNnz() { return val_.getSize(); }
+
+  /*!
+   * @brief Returns the position of the first nonzero of row i.
+   */
+  IndexType getRowBegin(IndexType i) { return rowPtr_.eval(i); }
+
+  /*!
+   * @brief Returns the position past the last nonzero of row i.
+   */
+  IndexType getRowEnd(IndexType i) { return rowPtr_.eval(i + 1); }
+
+  /*!
+   * @brief Returns the column of the nonzero in position k.
+   */
+  IndexType getCol(IndexType k) { return colIdx_.eval(k); }
+
+  /*!
+   * @brief Returns the value of the nonzero in position k.
+   */
+  value_type &eval(IndexType k) { return val_.eval(k); }
+};
+
+/*!
+@brief Template struct for a sparse matrix in sliced ELLPACK (SELL) format.
+The rows are split in slices of sliceSz rows, each one padded to its longest
+row and stored column-major, so that consecutive rows read consecutive
+positions. The padding holds zero values and valid column indices. The last
+slice is padded to sliceSz rows as well.
+@tparam SlicePtrT View of the slice pointers, zero based, with one more entry
+than slices. Slice s is stored from SlicePtr[s] to SlicePtr[s + 1].
+@tparam ColIdxT View of the column indices.
+@tparam ValT View of the values.
+*/
+template <class SlicePtrT_, class ColIdxT_, class ValT_>
+struct sell_view {
+  using SlicePtrT = SlicePtrT_;
+  using ColIdxT = ColIdxT_;
+  using ValT = ValT_;
+  using IndexType = typename ValT::IndexType;
+  using value_type = typename ValT::value_type;
+  SlicePtrT slicePtr_;
+  ColIdxT colIdx_;
+  ValT val_;
+  IndexType sizeR_;    // number of rows
+  IndexType sizeC_;    // number of columns
+  IndexType sliceSz_;  // number of rows of a slice
+
+  /*!
+   * @brief Constructs a SELL view on the slice pointers, the column indices
+   * and the values.
+   * @param sizeR Number of rows.
+   * @param sizeC Number of columns.
+   * @param sliceSz Number of rows of a slice.
+   */
+  sell_view(SlicePtrT slicePtr, ColIdxT colIdx, ValT val, IndexType sizeR,
+            IndexType sizeC, IndexType sliceSz)
+      : slicePtr_(slicePtr),
+        colIdx_(colIdx),
+        val_(val),
+        sizeR_(sizeR),
+        sizeC_(sizeC),
+        sliceSz_(sliceSz) {}
+
+  /*!
+   * @brief Returns the number of rows.
+   */
+  IndexType getSizeR() { return sizeR_; }
+
+  /*!
+   * @brief Returns the number of columns.
+   */
+  IndexType getSizeC() { return sizeC_; }
+
+  /*!
+   * @brief Returns the number of rows of a slice.
+   */
+  IndexType getSliceSz() { return sliceSz_; }
+
+  /*!
+   * @brief Returns the padded length of row i, the one of its slice.
+   */
+  IndexType getRowLength(IndexType i) {
+    auto s = i / sliceSz_;
+    return (slicePtr_.eval(s + 1) - slicePtr_.eval(s)) / sliceSz_;
+  }
+
+  /*!
+   * @brief Returns the position of the entry k of row i.
+   */
+  IndexType getIndex(IndexType i, IndexType k) {
+    return slicePtr_.eval(i / sliceSz_) + k * sliceSz_ + i % sliceSz_;
+  }
+
+  /*!
+   * @brief Returns the column of the entry in position k.
+   */
+  IndexType getCol(IndexType k) { return colIdx_.eval(k); }
+
+  /*!
+   * @brief Returns the value of the entry in position k.
+   */
+  value_type &eval(IndexType k) { return val_.eval(k); }
+};
+
+/*!
+@brief Template struct for a band matrix in the BLAS band storage, built over
+the vector view of the storage. Column j holds the rows j - ku to j + kl from
+position j * sizeL, the diagonal in row ku, so that A(i, j) is stored in
+ku + i - j + j * sizeL. eval(i, j) returns op(A)(i, j), zero outside the band.
+@tparam VectorT View of the storage.
+*/
+template <class VectorT_>
+struct band_view {
+  using VectorT = VectorT_;
+  using IndexType = typename VectorT::IndexType;
+  using value_type = typename VectorT::value_type;
+  VectorT data_;
+  IndexType sizeR_;  // number of rows
+  IndexType sizeC_;  // number of columns
+  IndexType kl_;     // number of subdiagonals stored
+  IndexType ku_;     // number of superdiagonals stored
+  IndexType sizeL_;  // size of the leading dimension, at least kl + ku + 1
+  int accessOpr_;    // Operation Access Mode (True: Normal, False: Transpose)
+  int symmetric_;    // True: the triangle not stored mirrors the stored one
+  int unit_;         // True: the diagonal is one, and is not read
+
+  /*!
+   * @brief Constructs a band view on the storage.
+   * @param sizeR Number of rows.
+   * @param sizeC Number of columns.
+   * @param kl Number of subdiagonals stored, 0 for a symmetric or triangular
+   * matrix stored by its upper triangle.
+   * @param ku Number of superdiagonals stored, 0 for a symmetric or
+   * triangular matrix stored by its lower triangle.
+   * @param sizeL Leading dimension.
+   * @param accessOpr Normal (True) or transposed (False).
+   * @param symmetric Symmetric matrix stored by one triangle.
+   * @param unit Triangular matrix with a unit diagonal.
+   */
+  band_view(VectorT data, IndexType sizeR, IndexType sizeC, IndexType kl,
+            IndexType ku, IndexType sizeL, int accessOpr = 1, int symmetric = 0,
+            int unit = 0)
+      : data_(data),
+        sizeR_(sizeR),
+        sizeC_(sizeC),
+        kl_(kl),
+        ku_(ku),
+        sizeL_(sizeL),
+        accessOpr_(accessOpr),
+        symmetric_(symmetric),
+        unit_(unit) {}
+
+  /*!
+   * @brief Returns the number of rows of op(A).
+   */
+  IndexType getSizeR() { return accessOpr_ ? sizeR_ : sizeC_; }
+
+  /*!
+   * @brief Returns the number of columns of op(A).
+   */
+  IndexType getSizeC() { return accessOpr_ ? sizeC_ : sizeR_; }
+
+  /*!
+   * @brief Returns the number of subdiagonals of op(A).
+   */
+  IndexType getBandL() {
+    return symmetric_ ? (kl_ + ku_) : (accessOpr_ ? kl_ : ku_);
+  }
+
+  /*!
+   * @brief Returns the number of superdiagonals of op(A).
+   */
+  IndexType getBandU() {
+    return symmetric_ ? (kl_ + ku_) : (accessOpr_ ? ku_ : kl_);
+  }
+
+  /*!
+   * @brief Returns the first column of the band in row i of op(A).
+   */
+  IndexType getRowBegin(IndexType i) {
+    auto bl = getBandL();
+    return (i > bl) ? (i - bl) : 0;
+  }
+
+  /*!
+   * @brief Returns the column past the band in row i of op(A).
+   */
+  IndexType getRowEnd(IndexType i) {
+    auto end = i + getBandU() + 1;
+    return (end < getSizeC()) ? end : getSizeC();
+  }
+
+  /*!
+   * @brief Returns op(A)(i, j).
+   */
+  value_type eval(IndexType i, IndexType j) {
+    auto row = accessOpr_ ? i : j;
+    auto col = accessOpr_ ? j : i;
+    if (symmetric_ && ((kl_ == 0) ? (row > col) : (row < col))) {
+      auto tmp = row;
+      row = col;
+      col = tmp;
+    }
+    if (unit_ && (row == col)) {
+      return value_type(1);
+    }
+    if ((row + ku_ < col) || (col + kl_ < row)) {
+      return value_type(0);
+    }
+    return data_.eval((ku_ + row) - col + col * sizeL_);
+  }
+};
+
+/*!
+@brief Template struct for a triangular matrix in the BLAS packed storage,
+built over the vector view of the storage. The columns of the triangle are
+stored one after the other: A(i, j) is stored in i + j * (j + 1) / 2 for an
+upper triangle, and in i + (2 * size - j - 1) * j / 2 for a lower one.
+eval(i, j) returns op(A)(i, j), zero outside the triangle.
+@tparam VectorT View of the storage.
+*/
+template <class VectorT_>
+struct packed_view {
+  using VectorT = VectorT_;
+  using IndexType = typename VectorT::IndexType;
+  using value_type = typename VectorT::value_type;
+  VectorT data_;
+  IndexType size_;  // number of rows and columns
+  int upper_;       // True: upper triangle, lower otherwise
+  int accessOpr_;   // Operation Access Mode (True: Normal, False: Transpose)
+  int unit_;        // True: the diagonal is one, and is not read
+
+  /*!
+   * @brief Constructs a packed view on the storage.
+   * @param size Number of rows and columns.
+   * @param upper Upper (True) or lower (False) triangle.
+   * @param accessOpr Normal (True) or transposed (False).
+   * @param unit Unit diagonal.
+   */
+  packed_view(VectorT data, IndexType size, int upper, int accessOpr = 1,
+              int unit = 0)
+      : data_(data),
+        size_(size),
+        upper_(upper),
+        accessOpr_(accessOpr),
+        unit_(unit) {}
+
+  /*!
+   * @brief Returns the number of rows.
+   */
+  IndexType getSizeR() { return size_; }
+
+  /*!
+   * @brief Returns the number of columns.
+   */
+  IndexType getSizeC() { return size_; }
+
+  /*!
+   * @brief True when op(A) is upper triangular.
+   */
+  bool isUpper() { return (upper_ != 0) == (accessOpr_ != 0); }
+
+  /*!
+   * @brief Returns the first column of the triangle in row i of op(A).
+   */
+  IndexType getRowBegin(IndexType i) { return isUpper() ? i : 0; }
+
+  /*!
+   * @brief Returns the column past the triangle in row i of op(A).
+   */
+  IndexType getRowEnd(IndexType i) { return isUpper() ? size_ : (i + 1); }
+
+  /*!
+   * @brief Returns op(A)(i, j).
+   */
+  value_type eval(IndexType i, IndexType j) {
+    auto row = accessOpr_ ? i : j;
+    auto col = accessOpr_ ? j : i;
+    if (unit_ && (row == col)) {
+      return value_type(1);
+    }
+    if (upper_ ? (row > col) : (row < col)) {
+      return value_type(0);
+    }
+    return data_.eval(upper_ ? (row + col * (col + 1) / 2)
+                             : (row + (2 * size_ - col - 1) * col / 2));
+  }
+};
+
 }  // namespace blas
 
 #endif  // OPERVIEW_BASE_HPP
@@ -0,0 +1,141 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas1_perf_test.cpp
+ *
+ **************************************************************************/
+
+#include "perf_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double> >
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+// the floors compare the effective bandwidth of each routine with the copy
+REGISTER_SIZE(1 << 22, axpy_perf_test)
+REGISTER_FLOOR(0.3, axpy_perf_test)
+REGISTER_SIZE(1 << 22, asum_perf_test)
+REGISTER_FLOOR(0.2, asum_perf_test)
+REGISTER_SIZE(1 << 22, dot_perf_test)
+REGISTER_FLOOR(0.2, dot_perf_test)
+
+TYPED_TEST(BLAS_Test, axpy_perf_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class axpy_perf_test;
+
+  size_t size = TestClass::template test_size<test>();
+  double floor = perf_floor<test>();
+
+  std::vector<ScalarT> vX(size);
+  std::vector<ScalarT> vY(size);
+  TestClass::set_rand(vX, size);
+  TestClass::set_rand(vY, size);
+  ScalarT alpha(1.54);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  const double baseline = stream_copy_bandwidth<ScalarT>(q, size);
+
+  auto gpu_vX = ex.template allocate<ScalarT>(size);
+  auto gpu_vY = ex.template allocate<ScalarT>(size);
+  ex.copy_to_device(vX.data(), gpu_vX, size);
+  ex.copy_to_device(vY.data(), gpu_vY, size);
+  const double seconds = perf_time([&]() {
+    _axpy(ex, size, alpha, gpu_vX, 1, gpu_vY, 1);
+    q.wait_and_throw();
+  });
+  const double bandwidth = double(3 * size * sizeof(ScalarT)) / seconds;
+  PERF_REPORT("axpy", "GB/s", bandwidth, baseline, floor);
+  ASSERT_GE(bandwidth, floor * baseline);
+  ex.template deallocate<ScalarT>(gpu_vX);
+  ex.template deallocate<ScalarT>(gpu_vY);
+}
+
+TYPED_TEST(BLAS_Test, asum_perf_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class asum_perf_test;
+
+  size_t size = TestClass::template test_size<test>();
+  double floor = perf_floor<test>();
+
+  std::vector<ScalarT> vX(size);
+  TestClass::set_rand(vX, size);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  const double baseline = stream_copy_bandwidth<ScalarT>(q, size);
+
+  auto gpu_vX = ex.template allocate<ScalarT>(size);
+  auto gpu_vR = ex.template allocate<ScalarT>(1);
+  ex.copy_to_device(vX.data(), gpu_vX, size);
+  const double seconds = perf_time([&]() {
+    _asum(ex, size, gpu_vX, 1, gpu_vR);
+    q.wait_and_throw();
+  });
+  const double bandwidth = double(size * sizeof(ScalarT)) / seconds;
+  PERF_REPORT("asum", "GB/s", bandwidth, baseline, floor);
+  ASSERT_GE(bandwidth, floor * baseline);
+  ex.template deallocate<ScalarT>(gpu_vX);
+  ex.template deallocate<ScalarT>(gpu_vR);
+}
+
+TYPED_TEST(BLAS_Test, dot_perf_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class dot_perf_test;
+
+  size_t size = TestClass::template test_size<test>();
+  double floor = perf_floor<test>();
+
+  std::vector<ScalarT> vX(size);
+  std::vector<ScalarT> vY(size);
+  TestClass::set_rand(vX, size);
+  TestClass::set_rand(vY, size);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  const double baseline = stream_copy_bandwidth<ScalarT>(q, size);
+
+  auto gpu_vX = ex.template allocate<ScalarT>(size);
+  auto gpu_vY = ex.template allocate<ScalarT>(size);
+  auto gpu_vR = ex.template allocate<ScalarT>(1);
+  ex.copy_to_device(vX.data(), gpu_vX, size);
+  ex.copy_to_device(vY.data(), gpu_vY, size);
+  const double seconds = perf_time([&]() {
+    _dot(ex, size, gpu_vX, 1, gpu_vY, 1, gpu_vR);
+    q.wait_and_throw();
+  });
+  const double bandwidth = double(2 * size * sizeof(ScalarT)) / seconds;
+  PERF_REPORT("dot", "GB/s", bandwidth, baseline, floor);
+  ASSERT_GE(bandwidth, floor * baseline);
+  ex.template deallocate<ScalarT>(gpu_vX);
+  ex.template deallocate<ScalarT>(gpu_vY);
+  ex.template deallocate<ScalarT>(gpu_vR);
+}
@@ -0,0 +1,83 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_perf_test.cpp
+ *
+ **************************************************************************/
+
+#include "perf_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+// an odd size, like the unit test, so that the partial tiles are included;
+// the tiled kernels have to be at least as fast as the naive one
+REGISTER_SIZE(511, gemm_perf_test)
+REGISTER_FLOOR(1.0, gemm_perf_test)
+
+TYPED_TEST(BLAS_Test, gemm_perf_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_perf_test;
+
+  size_t size = TestClass::template test_size<test>();
+  double floor = perf_floor<test>();
+  auto m = size;
+  auto n = size;
+  auto k = size;
+  ScalarT alpha = ScalarT(1);
+  ScalarT beta = ScalarT(1);
+
+  std::vector<ScalarT> a_m(m * k);
+  std::vector<ScalarT> b_m(k * n);
+  std::vector<ScalarT> c_m(m * n, ScalarT(0));
+  TestClass::set_rand(a_m, m * k);
+  TestClass::set_rand(b_m, k * n);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  const double baseline = naive_gemm_throughput<ScalarT>(q, m, n, k);
+
+  auto m_a_gpu = ex.template allocate<ScalarT>(m * k);
+  auto m_b_gpu = ex.template allocate<ScalarT>(k * n);
+  auto m_c_gpu = ex.template allocate<ScalarT>(m * n);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  ex.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  ex.copy_to_device(c_m.data(), m_c_gpu, m * n);
+  for (auto trans : {"nn", "tn"}) {
+    const double seconds = perf_time([&]() {
+      _gemm(ex, trans[0], trans[1], m, n, k, alpha, m_a_gpu, m, m_b_gpu, k,
+            beta, m_c_gpu, m);
+      q.wait_and_throw();
+    });
+    const double flops = double(2 * m * n * k) / seconds;
+    PERF_REPORT(std::string("gemm_") + trans, "GFlop/s", flops, baseline,
+                floor);
+    EXPECT_GE(flops, floor * baseline) << "transposition " << trans;
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+}
@@ -0,0 +1,154 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename perf_test.hpp
+ *
+ **************************************************************************/
+
+#ifndef PERF_TEST_HPP
+#define PERF_TEST_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include "blas_test.hpp"
+
+// Minimum throughput of a test, as a fraction of the throughput of its
+// baseline kernel on the same device.
+template <typename ClassName>
+struct option_floor;
+#define REGISTER_FLOOR(val, test_name)         \
+  template <>                                  \
+  struct option_floor<class test_name> {       \
+    static constexpr const double value = val; \
+  };
+
+// Number of timed repetitions, the median of which is compared.
+#ifndef PERF_TEST_REPS
+#define PERF_TEST_REPS 10
+#endif
+
+/*! perf_floor.
+ * The floor registered for the test, scaled by SYCLBLAS_PERF_FLOOR_SCALE
+ * when it is set, so that noisy machines can loosen every floor at once.
+ */
+template <typename test>
+double perf_floor() {
+  double scale = 1.0;
+  if (const char *env = std::getenv("SYCLBLAS_PERF_FLOOR_SCALE")) {
+    scale = std::atof(env);
+  }
+  return option_floor<test>::value * scale;
+}
+
+/*! perf_time.
+ * Median wall time in seconds of f, after one untimed call that absorbs
+ * the kernel compilation and the first transfers. f must wait for the work
+ * it submits.
+ */
+template <typename Function>
+double perf_time(Function f, size_t reps = PERF_TEST_REPS) {
+  f();
+  std::vector<double> times;
+  for (size_t i = 0; i < reps; i++) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    times.push_back(std::chrono::duration<double>(end - start).count());
+  }
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+template <typename T>
+class perf_stream_copy;
+
+/*! stream_copy_bandwidth.
+ * Bytes per second of a STREAM-like copy of `size` elements, written as a
+ * plain SYCL kernel so that the baseline does not move with the library.
+ */
+template <typename T>
+double stream_copy_bandwidth(cl::sycl::queue &q, size_t size) {
+  using namespace cl::sycl;
+  std::vector<T> host(size, T(1));
+  buffer<T, 1> in(host.data(), range<1>(size));
+  buffer<T, 1> out{range<1>(size)};
+  const double seconds = perf_time([&]() {
+    q.submit([&](handler &h) {
+      auto a = in.template get_access<access::mode::read>(h);
+      auto b = out.template get_access<access::mode::discard_write>(h);
+      h.parallel_for<perf_stream_copy<T>>(range<1>(size),
+                                          [=](id<1> i) { b[i] = a[i]; });
+    });
+    q.wait_and_throw();
+  });
+  return double(2 * size * sizeof(T)) / seconds;
+}
+
+template <typename T>
+class perf_naive_gemm;
+
+/*! naive_gemm_throughput.
+ * Flops per second of a column-major C = A * B with one work item per
+ * element of C and no use of local memory, the reference point of the
+ * tiled GEMM kernels.
+ */
+template <typename T>
+double naive_gemm_throughput(cl::sycl::queue &q, size_t m, size_t n,
+                             size_t k) {
+  using namespace cl::sycl;
+  std::vector<T> host_a(m * k, T(1)), host_b(k * n, T(1));
+  buffer<T, 1> buf_a(host_a.data(), range<1>(m * k));
+  buffer<T, 1> buf_b(host_b.data(), range<1>(k * n));
+  buffer<T, 1> buf_c{range<1>(m * n)};
+  const double seconds = perf_time([&]() {
+    q.submit([&](handler &h) {
+      auto a = buf_a.template get_access<access::mode::read>(h);
+      auto b = buf_b.template get_access<access::mode::read>(h);
+      auto c = buf_c.template get_access<access::mode::discard_write>(h);
+      h.parallel_for<perf_naive_gemm<T>>(range<2>(m, n), [=](id<2> idx) {
+        const size_t row = idx[0];
+        const size_t col = idx[1];
+        T acc(0);
+        for (size_t l = 0; l < k; l++) {
+          acc += a[row + l * m] * b[l + col * k];
+        }
+        c[row + col * m] = acc;
+      });
+    });
+    q.wait_and_throw();
+  });
+  return double(2 * m * n * k) / seconds;
+}
+
+/*! PERF_REPORT.
+ * Prints the measured and the baseline throughput, so that a failing test
+ * shows by how much it missed its floor.
+ */
+#define PERF_REPORT(name, unit, measured, baseline, floor)                \
+  std::cout << name << ": " << (measured) * 1e-9 << " " << unit << ", "   \
+            << "baseline " << (baseline) * 1e-9 << " " << unit << ", "    \
+            << "ratio " << (measured) / (baseline) << " (floor " << floor \
+            << ")" << std::endl
+
+#endif /* end of include guard: PERF_TEST_HPP */
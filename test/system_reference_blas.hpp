@@ -26,6 +26,97 @@
 #ifndef SYSTEM_REFERENCE_BLAS_HPP
 #define SYSTEM_REFERENCE_BLAS_HPP
 
+#define ENABLE_SYSTEM_SCAL(_type, _system_name)                     \
+  extern "C" void _system_name(const int *, const _type *, _type *, \
+                               const int *);                        \
+  void scal(int n, _type alpha, _type x[], int incX) {              \
+    _system_name(&n, &alpha, x, &incX);                             \
+  }
+
+ENABLE_SYSTEM_SCAL(float, sscal_)
+ENABLE_SYSTEM_SCAL(double, dscal_)
+
+#undef ENABLE_SYSTEM_SCAL
+
+#define ENABLE_SYSTEM_AXPY(_type, _system_name)                           \
+  extern "C" void _system_name(const int *, const _type *, const _type *, \
+                               const int *, _type *, const int *);        \
+  void axpy(int n, _type alpha, const _type x[], int incX, _type y[],     \
+            int incY) {                                                   \
+    _system_name(&n, &alpha, x, &incX, y, &incY);                         \
+  }
+
+ENABLE_SYSTEM_AXPY(float, saxpy_)
+ENABLE_SYSTEM_AXPY(double, daxpy_)
+
+#undef ENABLE_SYSTEM_AXPY
+
+#define ENABLE_SYSTEM_COPY(_type, _system_name)                         \
+  extern "C" void _system_name(const int *, const _type *, const int *, \
+                               _type *, const int *);                   \
+  void copy(int n, const _type x[], int incX, _type y[], int incY) {    \
+    _system_name(&n, x, &incX, y, &incY);                               \
+  }
+
+ENABLE_SYSTEM_COPY(float, scopy_)
+ENABLE_SYSTEM_COPY(double, dcopy_)
+
+#undef ENABLE_SYSTEM_COPY
+
+#define ENABLE_SYSTEM_SWAP(_type, _system_name)                            \
+  extern "C" void _system_name(const int *, _type *, const int *, _type *, \
+                               const int *);                               \
+  void swap(int n, _type x[], int incX, _type y[], int incY) {             \
+    _system_name(&n, x, &incX, y, &incY);                                  \
+  }
+
+ENABLE_SYSTEM_SWAP(float, sswap_)
+ENABLE_SYSTEM_SWAP(double, dswap_)
+
+#undef ENABLE_SYSTEM_SWAP
+
+#define ENABLE_SYSTEM_ROT(_type, _system_name)                             \
+  extern "C" void _system_name(const int *, _type *, const int *, _type *, \
+                               const int *, const _type *, const _type *); \
+  void rot(int n, _type x[], int incX, _type y[], int incY, _type c,       \
+           _type s) {                                                      \
+    _system_name(&n, x, &incX, y, &incY, &c, &s);                          \
+  }
+
+ENABLE_SYSTEM_ROT(float, srot_)
+ENABLE_SYSTEM_ROT(double, drot_)
+
+#undef ENABLE_SYSTEM_ROT
+
+#define ENABLE_SYSTEM_DOT(_type, _system_name)                             \
+  extern "C" _type _system_name(const int *, const _type *, const int *,   \
+                                const _type *, const int *);               \
+  _type dot(int n, const _type x[], int incX, const _type y[], int incY) { \
+    return _system_name(&n, x, &incX, y, &incY);                           \
+  }
+
+ENABLE_SYSTEM_DOT(float, sdot_)
+ENABLE_SYSTEM_DOT(double, ddot_)
+
+#undef ENABLE_SYSTEM_DOT
+
+// asum, nrm2 and iamax share the signature of a reduction over one vector;
+// note that iamax returns a one-based index
+#define ENABLE_SYSTEM_REDUCTION(_ret, _name, _type, _system_name)        \
+  extern "C" _ret _system_name(const int *, const _type *, const int *); \
+  _ret _name(int n, const _type x[], int incX) {                         \
+    return _system_name(&n, x, &incX);                                   \
+  }
+
+ENABLE_SYSTEM_REDUCTION(float, asum, float, sasum_)
+ENABLE_SYSTEM_REDUCTION(double, asum, double, dasum_)
+ENABLE_SYSTEM_REDUCTION(float, nrm2, float, snrm2_)
+ENABLE_SYSTEM_REDUCTION(double, nrm2, double, dnrm2_)
+ENABLE_SYSTEM_REDUCTION(int, iamax, float, isamax_)
+ENABLE_SYSTEM_REDUCTION(int, iamax, double, idamax_)
+
+#undef ENABLE_SYSTEM_REDUCTION
+
 #define ENABLE_SYSTEM_GEMV(_type, _system_name)                              \
   extern "C" void _system_name(const char *, const int *, const int *,       \
                                const _type *, const _type *, const int *,    \
@@ -56,6 +147,68 @@ ENABLE_SYSTEM_GER(double, dger_)
 
 #undef ENABLE_SYSTEM_GER
 
+#define ENABLE_SYSTEM_GBMV(_type, _system_name)                              \
+  extern "C" void _system_name(const char *, const int *, const int *,       \
+                               const int *, const int *, const _type *,      \
+                               const _type *, const int *, const _type *,    \
+                               const int *, const _type *, _type *,          \
+                               const int *);                                 \
+  void gbmv(const char *trans, int m, int n, int kl, int ku, _type alpha,    \
+            const _type a[], int lda, const _type b[], int incX, _type beta, \
+            _type c[], int incY) {                                           \
+    _system_name(trans, &m, &n, &kl, &ku, &alpha, a, &lda, b, &incX, &beta,  \
+                 c, &incY);                                                  \
+  }
+
+ENABLE_SYSTEM_GBMV(float, sgbmv_)
+ENABLE_SYSTEM_GBMV(double, dgbmv_)
+
+#undef ENABLE_SYSTEM_GBMV
+
+#define ENABLE_SYSTEM_SBMV(_type, _system_name)                             \
+  extern "C" void _system_name(const char *, const int *, const int *,      \
+                               const _type *, const _type *, const int *,   \
+                               const _type *, const int *, const _type *,   \
+                               _type *, const int *);                       \
+  void sbmv(const char *uplo, int n, int k, _type alpha, const _type a[],   \
+            int lda, const _type b[], int incX, _type beta, _type c[],      \
+            int incY) {                                                     \
+    _system_name(uplo, &n, &k, &alpha, a, &lda, b, &incX, &beta, c, &incY); \
+  }
+
+ENABLE_SYSTEM_SBMV(float, ssbmv_)
+ENABLE_SYSTEM_SBMV(double, dsbmv_)
+
+#undef ENABLE_SYSTEM_SBMV
+
+#define ENABLE_SYSTEM_TPMV(_type, _system_name)                           \
+  extern "C" void _system_name(const char *, const char *, const char *,  \
+                               const int *, const _type *, _type *,       \
+                               const int *);                              \
+  void tpmv(const char *uplo, const char *trans, const char *diag, int n, \
+            const _type ap[], _type b[], int incX) {                      \
+    _system_name(uplo, trans, diag, &n, ap, b, &incX);                    \
+  }
+
+ENABLE_SYSTEM_TPMV(float, stpmv_)
+ENABLE_SYSTEM_TPMV(double, dtpmv_)
+
+#undef ENABLE_SYSTEM_TPMV
+
+#define ENABLE_SYSTEM_TBSV(_type, _system_name)                           \
+  extern "C" void _system_name(const char *, const char *, const char *,  \
+                               const int *, const int *, const _type *,   \
+                               const int *, _type *, const int *);        \
+  void tbsv(const char *uplo, const char *trans, const char *diag, int n, \
+            int k, const _type a[], int lda, _type b[], int incX) {       \
+    _system_name(uplo, trans, diag, &n, &k, a, &lda, b, &incX);           \
+  }
+
+ENABLE_SYSTEM_TBSV(float, stbsv_)
+ENABLE_SYSTEM_TBSV(double, dtbsv_)
+
+#undef ENABLE_SYSTEM_TBSV
+
 #define ENABLE_SYSTEM_GEMM(_type, _system_name)                               \
   extern "C" void _system_name(                                               \
       const char *, const char *, const int *, const int *, const int *,      \
@@ -85,3 +85,108 @@ TYPED_TEST(BLAS_Test, axpy_test) {
   ex.template deallocate<ScalarT>(gpu_vX);
   ex.template deallocate<ScalarT>(gpu_vY);
 }
+
+REGISTER_SIZE(::RANDOM_SIZE, axpy_host_memory_test)
+REGISTER_PREC(float, 1e-4, axpy_host_memory_test)
+REGISTER_PREC(double, 1e-6, axpy_host_memory_test)
+REGISTER_PREC(std::complex<float>, 1e-4, axpy_host_memory_test)
+REGISTER_PREC(std::complex<double>, 1e-6, axpy_host_memory_test)
+
+TYPED_TEST(BLAS_Test, axpy_host_memory_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class axpy_host_memory_test;
+
+  size_t size = TestClass::template test_size<test>();
+  ScalarT prec = TestClass::template test_prec<test>();
+
+  ScalarT alpha(1.54);
+  std::vector<ScalarT> vX(size);
+  std::vector<ScalarT> vY(size);
+  TestClass::set_rand(vX, size);
+  TestClass::set_rand(vY, size);
+  std::vector<ScalarT> vZ(vY);
+  for (size_t i = 0; i < size; ++i) {
+    vZ[i] = alpha * vX[i] + vZ[i];
+  }
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  // the routines work on the host vectors, with no copy_to_device or
+  // copy_to_host
+  auto host_vX = ex.register_host_memory(vX.data(), size);
+  auto host_vY = ex.register_host_memory(vY.data(), size);
+  _axpy(ex, size, alpha, host_vX, 1, host_vY, 1);
+  ex.synchronize(host_vY);
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_NEAR(vZ[i], vY[i], prec);
+  }
+
+  // changes made on the host after synchronize are seen by the next calls
+  for (size_t i = 0; i < size; ++i) {
+    vY[i] = ScalarT(0);
+  }
+  _axpy(ex, size, alpha, host_vX, 1, host_vY, 1);
+  ex.unregister_host_memory(host_vX);
+  ex.unregister_host_memory(host_vY);
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_NEAR(alpha * vX[i], vY[i], prec);
+  }
+}
+
+REGISTER_SIZE(::RANDOM_SIZE, axpy_host_memory_unregister_test)
+REGISTER_PREC(float, 1e-4, axpy_host_memory_unregister_test)
+REGISTER_PREC(double, 1e-6, axpy_host_memory_unregister_test)
+REGISTER_PREC(std::complex<float>, 1e-4, axpy_host_memory_unregister_test)
+REGISTER_PREC(std::complex<double>, 1e-6, axpy_host_memory_unregister_test)
+
+TYPED_TEST(BLAS_Test, axpy_host_memory_unregister_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class axpy_host_memory_unregister_test;
+
+  size_t size = TestClass::template test_size<test>();
+  ScalarT prec = TestClass::template test_prec<test>();
+
+  ScalarT alpha(1.54);
+  std::vector<ScalarT> vX(size);
+  std::vector<ScalarT> vY(size);
+  TestClass::set_rand(vX, size);
+  TestClass::set_rand(vY, size);
+  std::vector<ScalarT> vZ(vY);
+  for (size_t i = 0; i < size; ++i) {
+    vZ[i] = alpha * vX[i] + vZ[i];
+  }
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto host_vX = ex.register_host_memory(vX.data(), size);
+  // the registration in the middle of the pointer map is released first,
+  // while other nodes follow it
+  std::unique_ptr<std::vector<ScalarT>> vT(new std::vector<ScalarT>(vX));
+  auto host_vT = ex.register_host_memory(vT->data(), size);
+  auto host_vY = ex.register_host_memory(vY.data(), size);
+  _axpy(ex, size, alpha, host_vT, 1, host_vT, 1);
+  ex.unregister_host_memory(host_vT);
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_NEAR((ScalarT(1) + alpha) * vX[i], (*vT)[i], prec);
+  }
+  // the buffer does not reference the host memory any more, it can go
+  vT.reset();
+
+  // the executor keeps working, on new allocations as on the other
+  // registrations, and releases everything without touching the memory
+  auto gpu_vW = ex.template allocate<ScalarT>(size);
+  ex.copy_to_device(vX.data(), gpu_vW, size);
+  _axpy(ex, size, alpha, gpu_vW, 1, host_vY, 1);
+  ex.unregister_host_memory(host_vY);
+  ex.unregister_host_memory(host_vX);
+  ex.template deallocate<ScalarT>(gpu_vW);
+  for (size_t i = 0; i < size; ++i) {
+    ASSERT_NEAR(vZ[i], vY[i], prec);
+  }
+}
@@ -0,0 +1,236 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_band_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+template <typename TypeParam>
+static void run_gbmv_test(const char* t_str, size_t m, size_t n, size_t kl,
+                          size_t ku, typename TypeParam::scalar_t prec) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+
+  size_t lda = kl + ku + 2;  // one row more than the band
+  size_t x_size = (*t_str == 'n') ? n : m;
+  size_t y_size = (*t_str == 'n') ? m : n;
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(lda * n);
+  std::vector<ScalarT> b_v(x_size);
+  std::vector<ScalarT> c_v_gpu_result(y_size);
+  TestClass::set_rand(a_m, lda * n);
+  TestClass::set_rand(b_v, x_size);
+  TestClass::set_rand(c_v_gpu_result, y_size);
+  std::vector<ScalarT> c_v_cpu(c_v_gpu_result);
+
+  // SYSTEM GBMV
+  gbmv(t_str, m, n, kl, ku, alpha, a_m.data(), lda, b_v.data(), 1, beta,
+       c_v_cpu.data(), 1);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<ScalarT>(lda * n);
+  auto v_b_gpu = ex.template allocate<ScalarT>(x_size);
+  auto v_c_gpu = ex.template allocate<ScalarT>(y_size);
+  ex.copy_to_device(a_m.data(), m_a_gpu, lda * n);
+  ex.copy_to_device(b_v.data(), v_b_gpu, x_size);
+  ex.copy_to_device(c_v_gpu_result.data(), v_c_gpu, y_size);
+  // SYCLGBMV
+  _gbmv(ex, *t_str, m, n, kl, ku, alpha, m_a_gpu, lda, v_b_gpu, 1, beta,
+        v_c_gpu, 1);
+  ex.copy_to_host(v_c_gpu, c_v_gpu_result.data(), y_size);
+  for (size_t i = 0; i < y_size; ++i) {
+    ASSERT_NEAR(c_v_gpu_result[i], c_v_cpu[i], prec);
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(v_b_gpu);
+  ex.template deallocate<ScalarT>(v_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-4, gbmv_test)
+REGISTER_PREC(double, 1e-8, gbmv_test)
+REGISTER_PREC(long double, 1e-8, gbmv_test)
+
+TYPED_TEST(BLAS_Test, gbmv_test) {
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gbmv_test;
+  auto prec = TestClass::template test_prec<test>();
+  run_gbmv_test<TypeParam>("n", 125, 127, 3, 5, prec);
+  run_gbmv_test<TypeParam>("t", 125, 127, 3, 5, prec);
+  run_gbmv_test<TypeParam>("n", 127, 125, 0, 2, prec);
+}
+
+REGISTER_PREC(float, 1e-4, sbmv_test)
+REGISTER_PREC(double, 1e-8, sbmv_test)
+REGISTER_PREC(long double, 1e-8, sbmv_test)
+
+TYPED_TEST(BLAS_Test, sbmv_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class sbmv_test;
+
+  size_t n = 127;
+  size_t k = 4;
+  size_t lda = k + 1;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+
+  for (auto uplo : {"u", "l"}) {
+    std::vector<ScalarT> a_m(lda * n);
+    std::vector<ScalarT> b_v(n);
+    std::vector<ScalarT> c_v_gpu_result(n);
+    TestClass::set_rand(a_m, lda * n);
+    TestClass::set_rand(b_v, n);
+    TestClass::set_rand(c_v_gpu_result, n);
+    std::vector<ScalarT> c_v_cpu(c_v_gpu_result);
+
+    // SYSTEM SBMV
+    sbmv(uplo, n, k, alpha, a_m.data(), lda, b_v.data(), 1, beta,
+         c_v_cpu.data(), 1);
+
+    SYCL_DEVICE_SELECTOR d;
+    auto q = TestClass::make_queue(d);
+    Executor<ExecutorType> ex(q);
+    auto m_a_gpu = ex.template allocate<ScalarT>(lda * n);
+    auto v_b_gpu = ex.template allocate<ScalarT>(n);
+    auto v_c_gpu = ex.template allocate<ScalarT>(n);
+    ex.copy_to_device(a_m.data(), m_a_gpu, lda * n);
+    ex.copy_to_device(b_v.data(), v_b_gpu, n);
+    ex.copy_to_device(c_v_gpu_result.data(), v_c_gpu, n);
+    // SYCLSBMV
+    _sbmv(ex, *uplo, n, k, alpha, m_a_gpu, lda, v_b_gpu, 1, beta, v_c_gpu, 1);
+    ex.copy_to_host(v_c_gpu, c_v_gpu_result.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_NEAR(c_v_gpu_result[i], c_v_cpu[i], prec);
+    }
+    ex.template deallocate<ScalarT>(m_a_gpu);
+    ex.template deallocate<ScalarT>(v_b_gpu);
+    ex.template deallocate<ScalarT>(v_c_gpu);
+  }
+}
+
+REGISTER_PREC(float, 1e-4, tpmv_test)
+REGISTER_PREC(double, 1e-8, tpmv_test)
+REGISTER_PREC(long double, 1e-8, tpmv_test)
+
+TYPED_TEST(BLAS_Test, tpmv_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class tpmv_test;
+
+  size_t n = 127;
+  size_t ap_size = n * (n + 1) / 2;
+  ScalarT prec = TestClass::template test_prec<test>();
+
+  for (auto uplo : {"u", "l"}) {
+    for (auto trans : {"n", "t"}) {
+      for (auto diag : {"n", "u"}) {
+        std::vector<ScalarT> ap_m(ap_size);
+        std::vector<ScalarT> b_v_gpu_result(n);
+        TestClass::set_rand(ap_m, ap_size);
+        TestClass::set_rand(b_v_gpu_result, n);
+        std::vector<ScalarT> b_v_cpu(b_v_gpu_result);
+
+        // SYSTEM TPMV
+        tpmv(uplo, trans, diag, n, ap_m.data(), b_v_cpu.data(), 1);
+
+        SYCL_DEVICE_SELECTOR d;
+        auto q = TestClass::make_queue(d);
+        Executor<ExecutorType> ex(q);
+        auto m_ap_gpu = ex.template allocate<ScalarT>(ap_size);
+        auto v_b_gpu = ex.template allocate<ScalarT>(n);
+        ex.copy_to_device(ap_m.data(), m_ap_gpu, ap_size);
+        ex.copy_to_device(b_v_gpu_result.data(), v_b_gpu, n);
+        // SYCLTPMV
+        _tpmv(ex, *uplo, *trans, *diag, n, m_ap_gpu, v_b_gpu, 1);
+        ex.copy_to_host(v_b_gpu, b_v_gpu_result.data(), n);
+        for (size_t i = 0; i < n; ++i) {
+          ASSERT_NEAR(b_v_gpu_result[i], b_v_cpu[i], prec);
+        }
+        ex.template deallocate<ScalarT>(m_ap_gpu);
+        ex.template deallocate<ScalarT>(v_b_gpu);
+      }
+    }
+  }
+}
+
+REGISTER_PREC(float, 1e-4, tbsv_test)
+REGISTER_PREC(double, 1e-8, tbsv_test)
+REGISTER_PREC(long double, 1e-8, tbsv_test)
+
+TYPED_TEST(BLAS_Test, tbsv_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class tbsv_test;
+
+  size_t n = 127;
+  size_t k = 5;
+  size_t lda = k + 1;
+  ScalarT prec = TestClass::template test_prec<test>();
+
+  for (auto uplo : {"u", "l"}) {
+    for (auto trans : {"n", "t"}) {
+      std::vector<ScalarT> a_m(lda * n);
+      std::vector<ScalarT> b_v_gpu_result(n);
+      TestClass::set_rand(a_m, lda * n);
+      TestClass::set_rand(b_v_gpu_result, n);
+      // A diagonally dominant matrix keeps the substitution stable
+      size_t diag = (*uplo == 'u') ? k : 0;
+      for (size_t j = 0; j < n; ++j) {
+        a_m[diag + j * lda] = ScalarT(k + 2);
+      }
+      std::vector<ScalarT> b_v_cpu(b_v_gpu_result);
+
+      // SYSTEM TBSV
+      tbsv(uplo, trans, "n", n, k, a_m.data(), lda, b_v_cpu.data(), 1);
+
+      SYCL_DEVICE_SELECTOR d;
+      auto q = TestClass::make_queue(d);
+      Executor<ExecutorType> ex(q);
+      auto m_a_gpu = ex.template allocate<ScalarT>(lda * n);
+      auto v_b_gpu = ex.template allocate<ScalarT>(n);
+      ex.copy_to_device(a_m.data(), m_a_gpu, lda * n);
+      ex.copy_to_device(b_v_gpu_result.data(), v_b_gpu, n);
+      // SYCLTBSV
+      _tbsv(ex, *uplo, *trans, 'n', n, k, m_a_gpu, lda, v_b_gpu, 1);
+      ex.copy_to_host(v_b_gpu, b_v_gpu_result.data(), n);
+      for (size_t i = 0; i < n; ++i) {
+        ASSERT_NEAR(b_v_gpu_result[i], b_v_cpu[i], prec);
+      }
+      ex.template deallocate<ScalarT>(m_a_gpu);
+      ex.template deallocate<ScalarT>(v_b_gpu);
+    }
+  }
+}
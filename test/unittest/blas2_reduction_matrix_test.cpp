@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_reduction_matrix_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+// Sizes of the matrices: a single thread, several threads and whole
+// workgroups per row or column
+static const size_t reduction_sizes[][2] = {{513, 1}, {125, 7}, {1025, 333}};
+
+REGISTER_PREC(float, 1e-4, asum_matrix_test)
+REGISTER_PREC(double, 1e-8, asum_matrix_test)
+REGISTER_PREC(long double, 1e-8, asum_matrix_test)
+
+TYPED_TEST(BLAS_Test, asum_matrix_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class asum_matrix_test;
+
+  ScalarT prec = TestClass::template test_prec<test>();
+  for (auto& sizes : reduction_sizes) {
+    for (auto dim : {'r', 'c'}) {
+      size_t m = (dim == 'r') ? sizes[1] : sizes[0];
+      size_t n = (dim == 'r') ? sizes[0] : sizes[1];
+      size_t lda = m + 3;
+      size_t r_size = (dim == 'r') ? m : n;
+      std::vector<ScalarT> a_m(lda * n);
+      std::vector<ScalarT> r_v_gpu_result(r_size, ScalarT(0));
+      std::vector<ScalarT> r_v_cpu(r_size, ScalarT(0));
+      TestClass::set_rand(a_m, lda * n);
+      for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < m; ++i) {
+          r_v_cpu[(dim == 'r') ? i : j] += std::abs(a_m[i + j * lda]);
+        }
+      }
+
+      SYCL_DEVICE_SELECTOR d;
+      auto q = TestClass::make_queue(d);
+      Executor<ExecutorType> ex(q);
+      auto m_a_gpu = ex.template allocate<ScalarT>(lda * n);
+      auto v_r_gpu = ex.template allocate<ScalarT>(r_size);
+      ex.copy_to_device(a_m.data(), m_a_gpu, lda * n);
+      _asum_matrix(ex, dim, m, n, m_a_gpu, lda, v_r_gpu, 1);
+      ex.copy_to_host(v_r_gpu, r_v_gpu_result.data(), r_size);
+      for (size_t i = 0; i < r_size; ++i) {
+        ASSERT_NEAR(r_v_gpu_result[i], r_v_cpu[i], prec);
+      }
+      ex.template deallocate<ScalarT>(m_a_gpu);
+      ex.template deallocate<ScalarT>(v_r_gpu);
+    }
+  }
+}
+
+REGISTER_PREC(float, 1e-4, nrm2_matrix_test)
+REGISTER_PREC(double, 1e-8, nrm2_matrix_test)
+REGISTER_PREC(long double, 1e-8, nrm2_matrix_test)
+
+TYPED_TEST(BLAS_Test, nrm2_matrix_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class nrm2_matrix_test;
+
+  ScalarT prec = TestClass::template test_prec<test>();
+  for (auto& sizes : reduction_sizes) {
+    for (auto dim : {'r', 'c'}) {
+      size_t m = (dim == 'r') ? sizes[1] : sizes[0];
+      size_t n = (dim == 'r') ? sizes[0] : sizes[1];
+      size_t lda = m;
+      size_t r_size = (dim == 'r') ? m : n;
+      std::vector<ScalarT> a_m(lda * n);
+      std::vector<ScalarT> r_v_gpu_result(r_size, ScalarT(0));
+      std::vector<ScalarT> r_v_cpu(r_size, ScalarT(0));
+      TestClass::set_rand(a_m, lda * n);
+      for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < m; ++i) {
+          ScalarT val = a_m[i + j * lda];
+          r_v_cpu[(dim == 'r') ? i : j] += val * val;
+        }
+      }
+      for (size_t i = 0; i < r_size; ++i) {
+        r_v_cpu[i] = std::sqrt(r_v_cpu[i]);
+      }
+
+      SYCL_DEVICE_SELECTOR d;
+      auto q = TestClass::make_queue(d);
+      Executor<ExecutorType> ex(q);
+      auto m_a_gpu = ex.template allocate<ScalarT>(lda * n);
+      auto v_r_gpu = ex.template allocate<ScalarT>(r_size);
+      ex.copy_to_device(a_m.data(), m_a_gpu, lda * n);
+      _nrm2_matrix(ex, dim, m, n, m_a_gpu, lda, v_r_gpu, 1);
+      ex.copy_to_host(v_r_gpu, r_v_gpu_result.data(), r_size);
+      for (size_t i = 0; i < r_size; ++i) {
+        ASSERT_NEAR(r_v_gpu_result[i], r_v_cpu[i], prec);
+      }
+      ex.template deallocate<ScalarT>(m_a_gpu);
+      ex.template deallocate<ScalarT>(v_r_gpu);
+    }
+  }
+}
+
+TYPED_TEST(BLAS_Test, iamax_matrix_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using TupleT = IndexValueTuple<ScalarT>;
+
+  for (auto& sizes : reduction_sizes) {
+    for (auto dim : {'r', 'c'}) {
+      size_t m = (dim == 'r') ? sizes[1] : sizes[0];
+      size_t n = (dim == 'r') ? sizes[0] : sizes[1];
+      size_t lda = m;
+      size_t r_size = (dim == 'r') ? m : n;
+      std::vector<ScalarT> a_m(lda * n);
+      TestClass::set_rand(a_m, lda * n);
+      // The first element of maximum and minimum absolute value
+      std::vector<size_t> imax_cpu(r_size, 0);
+      std::vector<size_t> imin_cpu(r_size, 0);
+      for (size_t s = 0; s < r_size; ++s) {
+        size_t seg_size = (dim == 'r') ? n : m;
+        auto elem = [&](size_t k) {
+          size_t ind = (dim == 'r') ? (s + k * lda) : (k + s * lda);
+          return std::abs(a_m[ind]);
+        };
+        for (size_t k = 1; k < seg_size; ++k) {
+          if (elem(k) > elem(imax_cpu[s])) imax_cpu[s] = k;
+          if (elem(k) < elem(imin_cpu[s])) imin_cpu[s] = k;
+        }
+      }
+      std::vector<TupleT> r_v_gpu_result(
+          r_size, constant<TupleT, const_val::imax>::value);
+
+      SYCL_DEVICE_SELECTOR d;
+      auto q = TestClass::make_queue(d);
+      Executor<ExecutorType> ex(q);
+      auto m_a_gpu = ex.template allocate<ScalarT>(lda * n);
+      auto v_r_gpu = ex.template allocate<TupleT>(r_size);
+      ex.copy_to_device(a_m.data(), m_a_gpu, lda * n);
+      _iamax_matrix(ex, dim, m, n, m_a_gpu, lda, v_r_gpu, 1);
+      ex.copy_to_host(v_r_gpu, r_v_gpu_result.data(), r_size);
+      for (size_t i = 0; i < r_size; ++i) {
+        ASSERT_EQ(r_v_gpu_result[i].get_index(), imax_cpu[i]);
+      }
+      _iamin_matrix(ex, dim, m, n, m_a_gpu, lda, v_r_gpu, 1);
+      ex.copy_to_host(v_r_gpu, r_v_gpu_result.data(), r_size);
+      for (size_t i = 0; i < r_size; ++i) {
+        ASSERT_EQ(r_v_gpu_result[i].get_index(), imin_cpu[i]);
+      }
+      ex.template deallocate<ScalarT>(m_a_gpu);
+      ex.template deallocate<TupleT>(v_r_gpu);
+    }
+  }
+}
+
+REGISTER_PREC(float, 1e-4, reduction_matrix_test)
+REGISTER_PREC(double, 1e-8, reduction_matrix_test)
+REGISTER_PREC(long double, 1e-8, reduction_matrix_test)
+
+TYPED_TEST(BLAS_Test, reduction_matrix_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class reduction_matrix_test;
+
+  size_t m = 125;
+  size_t n = 127;
+  ScalarT prec = TestClass::template test_prec<test>();
+  std::vector<ScalarT> a_m(m * n);
+  std::vector<ScalarT> r_v_gpu_result(m, ScalarT(0));
+  std::vector<ScalarT> r_v_cpu(m, ScalarT(0));
+  TestClass::set_rand(a_m, m * n);
+  // Row sums, with an operator the matrix routines have no name for
+  for (size_t j = 0; j < n; ++j) {
+    for (size_t i = 0; i < m; ++i) {
+      r_v_cpu[i] += a_m[i + j * m];
+    }
+  }
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<ScalarT>(m * n);
+  auto v_r_gpu = ex.template allocate<ScalarT>(m);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * n);
+  _reduction_matrix<addOp2_struct>(ex, 'r', m, n, m_a_gpu, m, v_r_gpu, 1);
+  ex.copy_to_host(v_r_gpu, r_v_gpu_result.data(), m);
+  for (size_t i = 0; i < m; ++i) {
+    ASSERT_NEAR(r_v_gpu_result[i], r_v_cpu[i], prec);
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(v_r_gpu);
+}
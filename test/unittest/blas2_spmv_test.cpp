@@ -0,0 +1,297 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas2_spmv_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+// Builds a random m x n CSR matrix with rows of 0 to 2 * avg_row nonzeros, and
+// its dense column-major copy for the reference gemv.
+template <typename ScalarT, typename TestClass>
+static void make_csr(size_t m, size_t n, size_t avg_row,
+                     std::vector<int>& row_ptr, std::vector<int>& col_idx,
+                     std::vector<ScalarT>& val, std::vector<ScalarT>& dense) {
+  row_ptr.assign(1, 0);
+  col_idx.clear();
+  dense.assign(m * n, ScalarT(0));
+  for (size_t i = 0; i < m; ++i) {
+    size_t len = std::min<size_t>(rand() % (2 * avg_row + 1), n);
+    size_t frst = rand() % (n - len + 1);
+    for (size_t j = frst; j < frst + len; ++j) {
+      col_idx.push_back(j);
+    }
+    row_ptr.push_back(col_idx.size());
+  }
+  val.resize(col_idx.size());
+  TestClass::set_rand(val, val.size());
+  for (size_t i = 0; i < m; ++i) {
+    for (int k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+      dense[i + col_idx[k] * m] = val[k];
+    }
+  }
+}
+
+template <typename TypeParam>
+static void run_spmv_test(size_t m, size_t n, size_t avg_row,
+                          typename TypeParam::scalar_t prec) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<int> row_ptr;
+  std::vector<int> col_idx;
+  std::vector<ScalarT> val;
+  std::vector<ScalarT> a_m;
+  make_csr<ScalarT, TestClass>(m, n, avg_row, row_ptr, col_idx, val, a_m);
+  size_t nnz = val.size();
+  std::vector<ScalarT> b_v(n);
+  std::vector<ScalarT> c_v_gpu_result(m);
+  TestClass::set_rand(b_v, n);
+  TestClass::set_rand(c_v_gpu_result, m);
+  std::vector<ScalarT> c_v_cpu(c_v_gpu_result);
+
+  // SYSTEM GEMMV
+  gemv("n", m, n, alpha, a_m.data(), m, b_v.data(), 1, beta, c_v_cpu.data(),
+       1);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto row_ptr_gpu = ex.template allocate<int>(m + 1);
+  auto col_idx_gpu = ex.template allocate<int>(nnz);
+  auto val_gpu = ex.template allocate<ScalarT>(nnz);
+  auto v_b_gpu = ex.template allocate<ScalarT>(n);
+  auto v_c_gpu = ex.template allocate<ScalarT>(m);
+  ex.copy_to_device(row_ptr.data(), row_ptr_gpu, m + 1);
+  ex.copy_to_device(col_idx.data(), col_idx_gpu, nnz);
+  ex.copy_to_device(val.data(), val_gpu, nnz);
+  ex.copy_to_device(b_v.data(), v_b_gpu, n);
+  ex.copy_to_device(c_v_gpu_result.data(), v_c_gpu, m);
+  // SYCLSPMV
+  _spmv(ex, m, n, nnz, alpha, row_ptr_gpu, col_idx_gpu, val_gpu, v_b_gpu, 1,
+        beta, v_c_gpu, 1);
+  ex.copy_to_host(v_c_gpu, c_v_gpu_result.data(), m);
+  for (size_t i = 0; i < m; ++i) {
+    ASSERT_NEAR(c_v_gpu_result[i], c_v_cpu[i], prec);
+  }
+  ex.template deallocate<int>(row_ptr_gpu);
+  ex.template deallocate<int>(col_idx_gpu);
+  ex.template deallocate<ScalarT>(val_gpu);
+  ex.template deallocate<ScalarT>(v_b_gpu);
+  ex.template deallocate<ScalarT>(v_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-4, spmv_test)
+REGISTER_PREC(double, 1e-8, spmv_test)
+REGISTER_PREC(long double, 1e-8, spmv_test)
+
+TYPED_TEST(BLAS_Test, spmv_test) {
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class spmv_test;
+  // one thread per row
+  run_spmv_test<TypeParam>(1025, 513, 3,
+                           TestClass::template test_prec<test>());
+}
+
+REGISTER_PREC(float, 1e-3, spmv_test_long_rows)
+REGISTER_PREC(double, 1e-8, spmv_test_long_rows)
+REGISTER_PREC(long double, 1e-8, spmv_test_long_rows)
+
+TYPED_TEST(BLAS_Test, spmv_test_long_rows) {
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class spmv_test_long_rows;
+  // several threads per row
+  run_spmv_test<TypeParam>(513, 1025, 40,
+                           TestClass::template test_prec<test>());
+}
+
+REGISTER_PREC(float, 1e-4, spmv_sell_test)
+REGISTER_PREC(double, 1e-8, spmv_sell_test)
+REGISTER_PREC(long double, 1e-8, spmv_sell_test)
+
+TYPED_TEST(BLAS_Test, spmv_sell_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class spmv_sell_test;
+
+  size_t m = 1023;
+  size_t n = 517;
+  size_t slice_sz = 32;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1);
+  ScalarT beta = ScalarT(1);
+  std::vector<int> row_ptr;
+  std::vector<int> col_idx;
+  std::vector<ScalarT> val;
+  std::vector<ScalarT> a_m;
+  make_csr<ScalarT, TestClass>(m, n, 5, row_ptr, col_idx, val, a_m);
+
+  // CSR TO SELL, THE PADDING REPEATS THE COLUMN 0 WITH A ZERO VALUE
+  size_t n_slices = (m + slice_sz - 1) / slice_sz;
+  std::vector<int> slice_ptr(1, 0);
+  for (size_t s = 0; s < n_slices; ++s) {
+    int len = 0;
+    for (size_t i = s * slice_sz; i < std::min(m, (s + 1) * slice_sz); ++i) {
+      len = std::max(len, row_ptr[i + 1] - row_ptr[i]);
+    }
+    slice_ptr.push_back(slice_ptr.back() + len * slice_sz);
+  }
+  size_t nnz = slice_ptr.back();
+  std::vector<int> sell_col(nnz, 0);
+  std::vector<ScalarT> sell_val(nnz, ScalarT(0));
+  for (size_t i = 0; i < m; ++i) {
+    size_t pos = slice_ptr[i / slice_sz] + i % slice_sz;
+    for (int k = row_ptr[i]; k < row_ptr[i + 1]; ++k, pos += slice_sz) {
+      sell_col[pos] = col_idx[k];
+      sell_val[pos] = val[k];
+    }
+  }
+
+  std::vector<ScalarT> b_v(n);
+  std::vector<ScalarT> c_v_gpu_result(m, ScalarT(0));
+  std::vector<ScalarT> c_v_cpu(m, ScalarT(0));
+  TestClass::set_rand(b_v, n);
+
+  // SYSTEM GEMMV
+  gemv("n", m, n, alpha, a_m.data(), m, b_v.data(), 1, beta, c_v_cpu.data(),
+       1);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto slice_ptr_gpu = ex.template allocate<int>(n_slices + 1);
+  auto col_idx_gpu = ex.template allocate<int>(nnz);
+  auto val_gpu = ex.template allocate<ScalarT>(nnz);
+  auto v_b_gpu = ex.template allocate<ScalarT>(n);
+  auto v_c_gpu = ex.template allocate<ScalarT>(m);
+  ex.copy_to_device(slice_ptr.data(), slice_ptr_gpu, n_slices + 1);
+  ex.copy_to_device(sell_col.data(), col_idx_gpu, nnz);
+  ex.copy_to_device(sell_val.data(), val_gpu, nnz);
+  ex.copy_to_device(b_v.data(), v_b_gpu, n);
+  ex.copy_to_device(c_v_gpu_result.data(), v_c_gpu, m);
+  // SYCLSPMV
+  _spmv_sell(ex, m, n, slice_sz, nnz, alpha, slice_ptr_gpu, col_idx_gpu,
+             val_gpu, v_b_gpu, 1, beta, v_c_gpu, 1);
+  ex.copy_to_host(v_c_gpu, c_v_gpu_result.data(), m);
+  for (size_t i = 0; i < m; ++i) {
+    ASSERT_NEAR(c_v_gpu_result[i], c_v_cpu[i], prec);
+  }
+  ex.template deallocate<int>(slice_ptr_gpu);
+  ex.template deallocate<int>(col_idx_gpu);
+  ex.template deallocate<ScalarT>(val_gpu);
+  ex.template deallocate<ScalarT>(v_b_gpu);
+  ex.template deallocate<ScalarT>(v_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-2, spmv_dot_fused_test)
+REGISTER_PREC(double, 1e-6, spmv_dot_fused_test)
+REGISTER_PREC(long double, 1e-6, spmv_dot_fused_test)
+
+// y = A * x and x . y in a single kernel, the step of a CG solver
+TYPED_TEST(BLAS_Test, spmv_dot_fused_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class spmv_dot_fused_test;
+
+  size_t m = 1025;
+  ScalarT prec = TestClass::template test_prec<test>();
+  std::vector<int> row_ptr;
+  std::vector<int> col_idx;
+  std::vector<ScalarT> val;
+  std::vector<ScalarT> a_m;
+  make_csr<ScalarT, TestClass>(m, m, 4, row_ptr, col_idx, val, a_m);
+  size_t nnz = val.size();
+  std::vector<ScalarT> x_v(m);
+  std::vector<ScalarT> y_v_gpu_result(m, ScalarT(0));
+  std::vector<ScalarT> y_v_cpu(m, ScalarT(0));
+  TestClass::set_rand(x_v, m);
+
+  // SYSTEM GEMMV AND DOT
+  gemv("n", m, m, ScalarT(1), a_m.data(), m, x_v.data(), 1, ScalarT(0),
+       y_v_cpu.data(), 1);
+  ScalarT r_cpu = dot(m, x_v.data(), 1, y_v_cpu.data(), 1);
+
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto row_ptr_gpu = ex.template allocate<int>(m + 1);
+  auto col_idx_gpu = ex.template allocate<int>(nnz);
+  auto val_gpu = ex.template allocate<ScalarT>(nnz);
+  auto v_x_gpu = ex.template allocate<ScalarT>(m);
+  auto v_y_gpu = ex.template allocate<ScalarT>(m);
+  auto r_gpu = ex.template allocate<ScalarT>(1);
+  ex.copy_to_device(row_ptr.data(), row_ptr_gpu, m + 1);
+  ex.copy_to_device(col_idx.data(), col_idx_gpu, nnz);
+  ex.copy_to_device(val.data(), val_gpu, nnz);
+  ex.copy_to_device(x_v.data(), v_x_gpu, m);
+
+  using RHS = vector_view<
+      ScalarT, typename Executor<ExecutorType>::template ContainerT<ScalarT>>;
+  using IDX = vector_view<
+      int, typename Executor<ExecutorType>::template ContainerT<int>>;
+  auto row_ptr_container = ex.get_buffer(row_ptr_gpu);
+  IDX my_row_ptr(row_ptr_container, ex.get_offset(row_ptr_gpu), 1, m + 1);
+  auto col_idx_container = ex.get_buffer(col_idx_gpu);
+  IDX my_col_idx(col_idx_container, ex.get_offset(col_idx_gpu), 1, nnz);
+  auto val_container = ex.get_buffer(val_gpu);
+  RHS my_val(val_container, ex.get_offset(val_gpu), 1, nnz);
+  csr_view<IDX, IDX, RHS> my_a(my_row_ptr, my_col_idx, my_val, m);
+  auto x_container = ex.get_buffer(v_x_gpu);
+  RHS my_x(x_container, ex.get_offset(v_x_gpu), 1, m);
+  auto y_container = ex.get_buffer(v_y_gpu);
+  RHS my_y(y_container, ex.get_offset(v_y_gpu), 1, m);
+  auto r_container = ex.get_buffer(r_gpu);
+  RHS my_r(r_container, ex.get_offset(r_gpu), 1, 1);
+
+  auto spmvOp = make_prdRowCsrVct(my_a, my_x);
+  auto assignOp = make_op<Assign>(my_y, spmvOp);
+  auto prdOp = make_op<BinaryOp, prdOp2_struct>(my_x, assignOp);
+  auto localSize = 256;
+  auto nWG = 512;
+  auto dotOp =
+      make_addAssignReduction(my_r, prdOp, localSize, localSize * nWG);
+  ex.reduce(dotOp);
+
+  ScalarT r_gpu_result;
+  ex.copy_to_host(r_gpu, &r_gpu_result, 1);
+  ex.copy_to_host(v_y_gpu, y_v_gpu_result.data(), m);
+  for (size_t i = 0; i < m; ++i) {
+    ASSERT_NEAR(y_v_gpu_result[i], y_v_cpu[i], 1e-4);
+  }
+  ASSERT_NEAR(r_gpu_result, r_cpu, prec);
+  ex.template deallocate<int>(row_ptr_gpu);
+  ex.template deallocate<int>(col_idx_gpu);
+  ex.template deallocate<ScalarT>(val_gpu);
+  ex.template deallocate<ScalarT>(v_x_gpu);
+  ex.template deallocate<ScalarT>(v_y_gpu);
+  ex.template deallocate<ScalarT>(r_gpu);
+}
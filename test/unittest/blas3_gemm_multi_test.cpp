@@ -0,0 +1,84 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_multi_test.cpp
+ *
+ **************************************************************************/
+
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+REGISTER_PREC(float, 1e-4, gemm_multi_test)
+REGISTER_PREC(double, 1e-8, gemm_multi_test)
+REGISTER_PREC(long double, 1e-8, gemm_multi_test)
+
+TYPED_TEST(BLAS_Test, gemm_multi_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_multi_test;
+  // three queues on the same device stand for three devices
+  const size_t m = 131;
+  const size_t n = 75;
+  const size_t k = 67;
+  const size_t ld = 140;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(ld * ld);
+  std::vector<ScalarT> b_m(ld * ld);
+  std::vector<ScalarT> c_m(ld * n);
+  TestClass::set_rand(a_m, a_m.size());
+  TestClass::set_rand(b_m, b_m.size());
+  TestClass::set_rand(c_m, c_m.size());
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  std::vector<cl::sycl::queue> queues(3, q);
+  queues[1] = cl::sycl::queue(q.get_context(), q.get_device());
+  queues[2] = cl::sycl::queue(q.get_context(), q.get_device());
+  Executor<ExecutorType> ex0(queues[0]), ex1(queues[1]), ex2(queues[2]);
+  std::vector<Executor<ExecutorType>*> executors = {&ex0, &ex1, &ex2};
+  for (auto trans : {"nn", "tn", "nt", "tt"}) {
+    std::vector<ScalarT> c_m_cpu(c_m);
+    gemm(&trans[0], &trans[1], m, n, k, alpha, a_m.data(), ld, b_m.data(), ld,
+         beta, c_m_cpu.data(), ld);
+    // the second call splits C by the throughput measured in the first one,
+    // the third one with a skewed split
+    std::vector<double> throughput;
+    for (int call = 0; call < 3; ++call) {
+      if (call == 2) throughput = {1.0, 0.0, 10.0};
+      std::vector<ScalarT> c_m_result(c_m);
+      _gemm_multi(executors, trans[0], trans[1], m, n, k, alpha, a_m.data(),
+                  ld, b_m.data(), ld, beta, c_m_result.data(), ld,
+                  throughput);
+      ASSERT_EQ(throughput.size(), executors.size());
+      for (size_t i = 0; i < c_m.size(); ++i) {
+        ASSERT_NEAR(c_m_result[i], c_m_cpu[i], prec)
+            << trans << " " << call << " " << i;
+      }
+    }
+  }
+}
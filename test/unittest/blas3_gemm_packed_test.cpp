@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_packed_test.cpp
+ *
+ **************************************************************************/
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+REGISTER_PREC(float, 1e-4, gemm_packed_test)
+REGISTER_PREC(double, 1e-8, gemm_packed_test)
+REGISTER_PREC(long double, 1e-8, gemm_packed_test)
+
+TYPED_TEST(BLAS_Test, gemm_packed_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_packed_test;
+  // none of the sizes is a multiple of a tile, so the padding is exercised
+  const size_t m = 131;
+  const size_t n = 75;
+  const size_t k = 67;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(m * k);
+  std::vector<ScalarT> b_m(k * n);
+  std::vector<ScalarT> c_m(m * n);
+  TestClass::set_rand(a_m, m * k);
+  TestClass::set_rand(b_m, k * n);
+  TestClass::set_rand(c_m, m * n);
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  const size_t size_a = _gemm_packed_size_a<ScalarT>(ex, m, k);
+  const size_t size_b = _gemm_packed_size_b<ScalarT>(ex, k, n);
+  auto m_a_gpu = ex.template allocate<ScalarT>(m * k);
+  auto m_b_gpu = ex.template allocate<ScalarT>(k * n);
+  auto m_c_gpu = ex.template allocate<ScalarT>(m * n);
+  auto m_a_packed = ex.template allocate<ScalarT>(size_a);
+  auto m_b_packed = ex.template allocate<ScalarT>(size_b);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  ex.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  for (auto trans : {"nn", "tn", "nt", "tt"}) {
+    const size_t lda = (trans[0] == 'n') ? m : k;
+    const size_t ldb = (trans[1] == 'n') ? k : n;
+    std::vector<ScalarT> c_m_cpu(c_m);
+    gemm(&trans[0], &trans[1], m, n, k, alpha, a_m.data(), lda, b_m.data(),
+         ldb, beta, c_m_cpu.data(), m);
+    _gemm_pack_a(ex, trans[0], m, k, m_a_gpu, lda, m_a_packed);
+    _gemm_pack_b(ex, trans[1], k, n, m_b_gpu, ldb, m_b_packed);
+
+    // both operands packed
+    std::vector<ScalarT> c_m_gpu_result(c_m);
+    ex.copy_to_device(c_m_gpu_result.data(), m_c_gpu, m * n);
+    _gemm_compute(ex, m, n, k, alpha, m_a_packed, m_b_packed, beta, m_c_gpu,
+                  m);
+    ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), m * n);
+    for (size_t i = 0; i < m * n; ++i) {
+      ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec) << trans << " " << i;
+    }
+
+    // only A packed
+    c_m_gpu_result = c_m;
+    ex.copy_to_device(c_m_gpu_result.data(), m_c_gpu, m * n);
+    _gemm_compute(ex, trans[1], m, n, k, alpha, m_a_packed, m_b_gpu, ldb, beta,
+                  m_c_gpu, m);
+    ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), m * n);
+    for (size_t i = 0; i < m * n; ++i) {
+      ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec) << trans << " " << i;
+    }
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+  ex.template deallocate<ScalarT>(m_a_packed);
+  ex.template deallocate<ScalarT>(m_b_packed);
+}
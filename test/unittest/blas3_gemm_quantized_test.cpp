@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_quantized_test.cpp
+ *
+ **************************************************************************/
+
+#include <cmath>
+#include <cstdint>
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+TYPED_TEST(BLAS_Test, gemm_quantized_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  // asymmetric uint8_t activations, symmetric int8_t weights and an int8_t
+  // output, as in a quantized inference layer
+  const size_t m = 131;
+  const size_t n = 75;
+  const size_t k = 67;
+  const int32_t a_zero = 128;
+  const int32_t b_zero = 0;
+  const int32_t c_zero = -3;
+  std::vector<uint8_t> a_m(m * k);
+  std::vector<int8_t> b_m(k * n);
+  std::vector<ScalarT> s_m(n);
+  for (auto& a : a_m) a = uint8_t(rand() % 256);
+  for (auto& b : b_m) b = int8_t(rand() % 255 - 127);
+  // scales that send part of the outputs out of the int8_t range, so that
+  // the saturation is exercised
+  for (auto& s : s_m) s = ScalarT(1 + rand() % 64) / ScalarT(8192);
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<uint8_t>(m * k);
+  auto m_b_gpu = ex.template allocate<int8_t>(k * n);
+  auto m_c_gpu = ex.template allocate<int8_t>(m * n);
+  auto m_s_gpu = ex.template allocate<ScalarT>(n);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  ex.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  ex.copy_to_device(s_m.data(), m_s_gpu, n);
+  for (auto trans : {"nn", "tn", "nt", "tt"}) {
+    const size_t lda = (trans[0] == 'n') ? m : k;
+    const size_t ldb = (trans[1] == 'n') ? k : n;
+    for (bool per_channel : {false, true}) {
+      std::vector<int8_t> c_m_gpu_result(m * n);
+      _gemm_quantized(ex, trans[0], trans[1], m, n, k, m_a_gpu, lda, a_zero,
+                      m_b_gpu, ldb, b_zero, m_s_gpu, per_channel, m_c_gpu, m,
+                      c_zero);
+      ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), m * n);
+      for (size_t j = 0; j < n; ++j) {
+        for (size_t i = 0; i < m; ++i) {
+          int32_t acc = 0;
+          for (size_t l = 0; l < k; ++l) {
+            const int32_t a =
+                a_m[(trans[0] == 'n') ? i + l * lda : l + i * lda];
+            const int32_t b =
+                b_m[(trans[1] == 'n') ? l + j * ldb : j + l * ldb];
+            acc += (a - a_zero) * (b - b_zero);
+          }
+          const ScalarT scale = s_m[per_channel ? j : 0];
+          ScalarT c = std::round(scale * ScalarT(acc) + ScalarT(c_zero));
+          c = std::min(std::max(c, ScalarT(-128)), ScalarT(127));
+          // the device may contract the scaling into a fused multiply-add,
+          // which moves values at a tie of rounding by one
+          ASSERT_LE(std::abs(int32_t(c_m_gpu_result[i + j * m]) - int32_t(c)),
+                    1)
+              << trans << " " << per_channel << " " << i << " " << j;
+        }
+      }
+    }
+  }
+  ex.template deallocate<uint8_t>(m_a_gpu);
+  ex.template deallocate<int8_t>(m_b_gpu);
+  ex.template deallocate<int8_t>(m_c_gpu);
+  ex.template deallocate<ScalarT>(m_s_gpu);
+}
@@ -0,0 +1,78 @@
+/***************************************************************************
+ *
+ *  @license
+ *  Copyright (C) Codeplay Software Limited
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  For your convenience, a copy of the License has been included in this
+ *  repository.
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  SYCL-BLAS: BLAS implementation using SYCL
+ *
+ *  @filename blas3_gemm_streaming_test.cpp
+ *
+ **************************************************************************/
+
+
+#include "blas_test.hpp"
+
+typedef ::testing::Types<blas_test_args<float>, blas_test_args<double>>
+    BlasTypes;
+
+TYPED_TEST_CASE(BLAS_Test, BlasTypes);
+
+REGISTER_PREC(float, 1e-4, gemm_streaming_test)
+REGISTER_PREC(double, 1e-8, gemm_streaming_test)
+REGISTER_PREC(long double, 1e-8, gemm_streaming_test)
+
+TYPED_TEST(BLAS_Test, gemm_streaming_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_streaming_test;
+  // panels that do not divide the matrices, and a leading dimension larger
+  // than the matrices so that writes outside of C show up
+  const size_t m = 131;
+  const size_t n = 75;
+  const size_t k = 67;
+  const size_t ld = 140;
+  const size_t panel_m = 40;
+  const size_t panel_n = 32;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(ld * ld);
+  std::vector<ScalarT> b_m(ld * ld);
+  std::vector<ScalarT> c_m(ld * n);
+  TestClass::set_rand(a_m, a_m.size());
+  TestClass::set_rand(b_m, b_m.size());
+  TestClass::set_rand(c_m, c_m.size());
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  for (auto trans : {"nn", "tn", "nt", "tt"}) {
+    std::vector<ScalarT> c_m_cpu(c_m);
+    gemm(&trans[0], &trans[1], m, n, k, alpha, a_m.data(), ld, b_m.data(), ld,
+         beta, c_m_cpu.data(), ld);
+    for (int stages = 1; stages <= 3; ++stages) {
+      std::vector<ScalarT> c_m_result(c_m);
+      _gemm_streaming(ex, trans[0], trans[1], m, n, k, alpha, a_m.data(), ld,
+                      b_m.data(), ld, beta, c_m_result.data(), ld, panel_m,
+                      panel_n, stages);
+      for (size_t i = 0; i < c_m.size(); ++i) {
+        ASSERT_NEAR(c_m_result[i], c_m_cpu[i], prec)
+            << trans << " " << stages << " " << i;
+      }
+    }
+  }
+}
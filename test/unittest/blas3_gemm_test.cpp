@@ -82,3 +82,275 @@ TYPED_TEST(BLAS_Test, gemm_test) {
   ex.template deallocate<ScalarT>(m_b_gpu);
   ex.template deallocate<ScalarT>(m_c_gpu);
 }
+
+REGISTER_PREC(float, 1e-4, gemm_submatrix_test)
+REGISTER_PREC(double, 1e-8, gemm_submatrix_test)
+REGISTER_PREC(long double, 1e-8, gemm_submatrix_test)
+
+TYPED_TEST(BLAS_Test, gemm_submatrix_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_submatrix_test;
+  // A, B and C are blocks of three 160x160 matrices, C is compared as a whole
+  // to check that nothing outside of its block is written
+  const size_t ld = 160;
+  const size_t m = 67;
+  const size_t n = 53;
+  const size_t k = 45;
+  const size_t ofs_a = 3 + 5 * ld;
+  const size_t ofs_b = 7 + 2 * ld;
+  const size_t ofs_c = 11 + 13 * ld;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(ld * ld);
+  std::vector<ScalarT> b_m(ld * ld);
+  std::vector<ScalarT> c_m_gpu_result(ld * ld);
+  TestClass::set_rand(a_m, ld * ld);
+  TestClass::set_rand(b_m, ld * ld);
+  TestClass::set_rand(c_m_gpu_result, ld * ld);
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<ScalarT>(ld * ld);
+  auto m_b_gpu = ex.template allocate<ScalarT>(ld * ld);
+  auto m_c_gpu = ex.template allocate<ScalarT>(ld * ld);
+  ex.copy_to_device(a_m.data(), m_a_gpu, ld * ld);
+  ex.copy_to_device(b_m.data(), m_b_gpu, ld * ld);
+  for (auto trans : {"nn", "tn", "nt", "tt"}) {
+    std::vector<ScalarT> c_m_cpu(c_m_gpu_result);
+    gemm(&trans[0], &trans[1], m, n, k, alpha, a_m.data() + ofs_a, ld,
+         b_m.data() + ofs_b, ld, beta, c_m_cpu.data() + ofs_c, ld);
+    ex.copy_to_device(c_m_gpu_result.data(), m_c_gpu, ld * ld);
+    _gemm(ex, trans[0], trans[1], m, n, k, alpha, m_a_gpu + ofs_a, ld,
+          m_b_gpu + ofs_b, ld, beta, m_c_gpu + ofs_c, ld);
+    ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), ld * ld);
+    for (size_t i = 0; i < ld * ld; ++i) {
+      ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec) << trans << " " << i;
+    }
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-4, gemm_pipeline_test)
+REGISTER_PREC(double, 1e-8, gemm_pipeline_test)
+REGISTER_PREC(long double, 1e-8, gemm_pipeline_test)
+
+TYPED_TEST(BLAS_Test, gemm_pipeline_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_pipeline_test;
+  // k is not a multiple of the block depth, so that the last prefetch is a
+  // partial one, and m and n are not multiples of the tile
+  const size_t m = 131;
+  const size_t n = 75;
+  const size_t k = 67;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(m * k);
+  std::vector<ScalarT> b_m(k * n);
+  std::vector<ScalarT> c_m(m * n);
+  TestClass::set_rand(a_m, m * k);
+  TestClass::set_rand(b_m, k * n);
+  TestClass::set_rand(c_m, m * n);
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<ScalarT>(m * k);
+  auto m_b_gpu = ex.template allocate<ScalarT>(k * n);
+  auto m_c_gpu = ex.template allocate<ScalarT>(m * n);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  ex.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  for (auto trans : {"nn", "tn", "nt", "tt"}) {
+    const bool ta = trans[0] == 't';
+    const bool tb = trans[1] == 't';
+    const size_t lda = ta ? k : m;
+    const size_t ldb = tb ? n : k;
+    std::vector<ScalarT> c_m_cpu(c_m);
+    gemm(&trans[0], &trans[1], m, n, k, alpha, a_m.data(), lda, b_m.data(),
+         ldb, beta, c_m_cpu.data(), m);
+    for (bool double_buffer : {false, true}) {
+      std::vector<ScalarT> c_m_gpu_result(m * n);
+      ex.copy_to_device(c_m.data(), m_c_gpu, m * n);
+      if (double_buffer) {
+        _select_gemm<128, true, false, false, 64, Tile<8, 8, 16, 16>, true>(
+            ex, ta, tb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldb, beta,
+            m_c_gpu, m);
+      } else {
+        _select_gemm<128, false, false, false, 64, Tile<4, 4, 8, 8>, true>(
+            ex, ta, tb, m, n, k, alpha, m_a_gpu, lda, m_b_gpu, ldb, beta,
+            m_c_gpu, m);
+      }
+      ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), m * n);
+      for (size_t i = 0; i < m * n; ++i) {
+        ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec)
+            << trans << " " << double_buffer << " " << i;
+      }
+    }
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-4, gemm_vector_test)
+REGISTER_PREC(double, 1e-8, gemm_vector_test)
+REGISTER_PREC(long double, 1e-8, gemm_vector_test)
+
+TYPED_TEST(BLAS_Test, gemm_vector_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_vector_test;
+  // large enough for full tiles, which use vector accesses when the operands
+  // start on a multiple of the vector size and fall back to scalar ones when
+  // they are shifted by ofs
+  const size_t m = 292;
+  const size_t n = 260;
+  const size_t k = 76;
+  const size_t ld = 292;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(ld * ld + 1);
+  std::vector<ScalarT> b_m(ld * ld + 1);
+  std::vector<ScalarT> c_m_gpu_result(ld * n + 1);
+  TestClass::set_rand(a_m, a_m.size());
+  TestClass::set_rand(b_m, b_m.size());
+  TestClass::set_rand(c_m_gpu_result, c_m_gpu_result.size());
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<ScalarT>(a_m.size());
+  auto m_b_gpu = ex.template allocate<ScalarT>(b_m.size());
+  auto m_c_gpu = ex.template allocate<ScalarT>(c_m_gpu_result.size());
+  ex.copy_to_device(a_m.data(), m_a_gpu, a_m.size());
+  ex.copy_to_device(b_m.data(), m_b_gpu, b_m.size());
+  for (size_t ofs : {0, 1}) {
+    for (auto trans : {"nn", "tn", "nt", "tt"}) {
+      std::vector<ScalarT> c_m_cpu(c_m_gpu_result);
+      gemm(&trans[0], &trans[1], m, n, k, alpha, a_m.data() + ofs, ld,
+           b_m.data() + ofs, ld, beta, c_m_cpu.data() + ofs, ld);
+      ex.copy_to_device(c_m_gpu_result.data(), m_c_gpu, c_m_cpu.size());
+      _gemm(ex, trans[0], trans[1], m, n, k, alpha, m_a_gpu + ofs, ld,
+            m_b_gpu + ofs, ld, beta, m_c_gpu + ofs, ld);
+      ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), c_m_cpu.size());
+      for (size_t i = 0; i < c_m_cpu.size(); ++i) {
+        ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec)
+            << trans << " " << ofs << " " << i;
+      }
+    }
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-4, gemm_raster_test)
+REGISTER_PREC(double, 1e-8, gemm_raster_test)
+REGISTER_PREC(long double, 1e-8, gemm_raster_test)
+
+TYPED_TEST(BLAS_Test, gemm_raster_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_raster_test;
+  // a 10 x 17 grid of 32 x 32 tiles: the last group of GroupedRaster<3> is
+  // partial and MortonRaster launches a 32 x 32 grid
+  const size_t m = 300;
+  const size_t n = 520;
+  const size_t k = 33;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(m * k);
+  std::vector<ScalarT> b_m(k * n);
+  std::vector<ScalarT> c_m(m * n);
+  TestClass::set_rand(a_m, m * k);
+  TestClass::set_rand(b_m, k * n);
+  TestClass::set_rand(c_m, m * n);
+  std::vector<ScalarT> c_m_cpu(c_m);
+  gemm("n", "n", m, n, k, alpha, a_m.data(), m, b_m.data(), k, beta,
+       c_m_cpu.data(), m);
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  auto m_a_gpu = ex.template allocate<ScalarT>(m * k);
+  auto m_b_gpu = ex.template allocate<ScalarT>(k * n);
+  auto m_c_gpu = ex.template allocate<ScalarT>(m * n);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  ex.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  for (int raster = 0; raster < 2; ++raster) {
+    std::vector<ScalarT> c_m_gpu_result(m * n);
+    ex.copy_to_device(c_m.data(), m_c_gpu, m * n);
+    if (raster == 0) {
+      _select_gemm<128, false, false, false, 64, Tile<4, 4, 8, 8>, false, 1,
+                   GroupedRaster<3>>(ex, false, false, m, n, k, alpha,
+                                     m_a_gpu, m, m_b_gpu, k, beta, m_c_gpu, m);
+    } else {
+      _select_gemm<128, false, false, false, 64, Tile<4, 4, 8, 8>, false, 1,
+                   MortonRaster>(ex, false, false, m, n, k, alpha, m_a_gpu, m,
+                                 m_b_gpu, k, beta, m_c_gpu, m);
+    }
+    ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), m * n);
+    for (size_t i = 0; i < m * n; ++i) {
+      ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec) << raster << " " << i;
+    }
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+}
+
+REGISTER_PREC(float, 1e-4, gemm_prepare_test)
+REGISTER_PREC(double, 1e-8, gemm_prepare_test)
+REGISTER_PREC(long double, 1e-8, gemm_prepare_test)
+
+TYPED_TEST(BLAS_Test, gemm_prepare_test) {
+  using ScalarT = typename TypeParam::scalar_t;
+  using ExecutorType = typename TypeParam::executor_t;
+  using TestClass = BLAS_Test<TypeParam>;
+  using test = class gemm_prepare_test;
+  // the kernels built by prepare are the ones the next calls use
+  const size_t m = 67;
+  const size_t n = 75;
+  const size_t k = 131;
+  ScalarT prec = TestClass::template test_prec<test>();
+  ScalarT alpha = ScalarT(1.5);
+  ScalarT beta = ScalarT(0.5);
+  std::vector<ScalarT> a_m(m * k);
+  std::vector<ScalarT> b_m(k * n);
+  std::vector<ScalarT> c_m(m * n);
+  TestClass::set_rand(a_m, m * k);
+  TestClass::set_rand(b_m, k * n);
+  TestClass::set_rand(c_m, m * n);
+  std::vector<ScalarT> c_m_cpu(c_m);
+  gemm("n", "t", m, n, k, alpha, a_m.data(), m, b_m.data(), n, beta,
+       c_m_cpu.data(), m);
+  SYCL_DEVICE_SELECTOR d;
+  auto q = TestClass::make_queue(d);
+  Executor<ExecutorType> ex(q);
+  ex.template prepare<routine::gemm<ScalarT>, routine::gemv<ScalarT>,
+                      routine::dot<ScalarT>, routine::iamax<ScalarT>>();
+  auto m_a_gpu = ex.template allocate<ScalarT>(m * k);
+  auto m_b_gpu = ex.template allocate<ScalarT>(k * n);
+  auto m_c_gpu = ex.template allocate<ScalarT>(m * n);
+  ex.copy_to_device(a_m.data(), m_a_gpu, m * k);
+  ex.copy_to_device(b_m.data(), m_b_gpu, k * n);
+  ex.copy_to_device(c_m.data(), m_c_gpu, m * n);
+  _gemm(ex, 'n', 't', m, n, k, alpha, m_a_gpu, m, m_b_gpu, n, beta, m_c_gpu,
+        m);
+  std::vector<ScalarT> c_m_gpu_result(m * n);
+  ex.copy_to_host(m_c_gpu, c_m_gpu_result.data(), m * n);
+  for (size_t i = 0; i < m * n; ++i) {
+    ASSERT_NEAR(c_m_gpu_result[i], c_m_cpu[i], prec) << i;
+  }
+  ex.template deallocate<ScalarT>(m_a_gpu);
+  ex.template deallocate<ScalarT>(m_b_gpu);
+  ex.template deallocate<ScalarT>(m_c_gpu);
+}